@@ -0,0 +1,62 @@
+#pragma once
+
+#include "mapped_file.h"
+
+#include <raylib.h>
+
+#include <cstdint>
+
+constexpr const char* ASSET_ARCHIVE = "assets.pak";
+
+// Every loose asset the game loads, packed in this order by PackAssets().
+constexpr const char* GAME_ASSET_FILES[] =
+{
+    "create.wav", "destroy.wav", "shoot.wav", "hit.wav", "death.wav",
+    "turret.png", "bullet.png", "enemy_normal.png", "enemy_fast.png", "enemy_heavy.png",
+};
+
+// Sounds are packed as 32-bit float stereo at this rate, the audio device format, so
+// LoadSoundFromWave only has to copy them when the device runs at the same rate, and
+// the mixer copies them straight into the mix instead of running a converter per voice.
+constexpr int PACK_SAMPLE_RATE = 48000;
+
+// Build step: decodes the given .png/.wav files and writes them to one archive,
+// textures as single-level DXT1/DXT5 blocks, ready for upload as they are
+// (raylib decodes them on the CPU if the GPU can't sample DXT), and sounds as device-format PCM.
+bool PackAssets(const char* archiveName, const char* const* fileNames, int fileCount);
+
+// Memory-mapped asset archive written by PackAssets().
+// Textures and sounds are created straight from the mapping; anything missing from the
+// archive (or every asset, if there's no archive) is loaded from the loose file instead.
+class AssetArchive
+{
+public:
+    struct Entry
+    {
+        char name[48];
+        uint32_t kind;
+        // Texture: width, height, pixel format, mipmaps. Sound: frame count, sample rate, sample size, channels.
+        uint32_t param[4];
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    bool Open(const char* fileName);
+    void Close();
+    bool IsOpen() const { return mEntries != nullptr; }
+
+    // Image/Wave pointing into the mapping, valid until Close(). Returns false if the asset isn't packed.
+    bool GetImage(const char* fileName, Image* image) const;
+    bool GetWave(const char* fileName, Wave* wave) const;
+
+    Texture2D LoadTexture(const char* fileName) const;
+    Sound LoadSound(const char* fileName) const;
+
+private:
+    const Entry* Find(const char* fileName, uint32_t kind) const;
+
+    MappedFile mFile;
+    const Entry* mEntries = nullptr;
+    uint32_t mEntryCount = 0;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "assets.h"
+
+#include <raylib.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Seconds of GPU/audio uploads the main thread spends per frame while assets are loading.
+constexpr double ASSET_UPLOAD_BUDGET = 0.004;
+
+// Loads textures and sounds without blocking the first frame.
+// Worker threads decode images (LoadImage) and waves (LoadWave) in parallel, or just look
+// them up when they're in the asset archive. Decoded results are queued for the main
+// thread, which uploads them with LoadTextureFromImage/LoadSoundFromWave inside a
+// per-frame time budget. Until its upload, each target keeps whatever placeholder it held.
+class AsyncAssetLoader
+{
+public:
+    explicit AsyncAssetLoader(const AssetArchive& archive);
+    ~AsyncAssetLoader();
+
+    AsyncAssetLoader(const AsyncAssetLoader&) = delete;
+    AsyncAssetLoader& operator=(const AsyncAssetLoader&) = delete;
+
+    // Targets must stay alive until the loader is done. Request everything before Start().
+    void RequestTexture(const char* fileName, Texture2D* target);
+    void RequestSound(const char* fileName, Sound* target);
+
+    void Start(int workerCount = 0);
+
+    // Stops claiming jobs, waits for the workers and frees results that were never uploaded.
+    // Must run before the archive is closed, since workers read from its mapping.
+    void Shutdown();
+
+    // Main thread only: uploads queued results until budgetSeconds has been spent.
+    // At least one result is uploaded per call so loading always makes progress.
+    void Update(double budgetSeconds);
+
+    bool IsDone() const { return mUploaded == (int)mJobs.size(); }
+    float Progress() const { return mJobs.empty() ? 1.0f : (float)mUploaded / mJobs.size(); }
+
+private:
+    struct Job
+    {
+        std::string fileName;
+        Texture2D* texture = nullptr;
+        Sound* sound = nullptr;
+
+        // Filled by the worker.
+        Image image = { 0 };
+        Wave wave = { 0 };
+        bool ownsData = false;   // false when the data points into the archive mapping
+    };
+
+    void WorkerMain();
+    void Upload(Job& job);
+
+    const AssetArchive& mArchive;
+    std::vector<Job> mJobs;
+    std::vector<std::thread> mWorkers;
+    std::atomic<int> mNextJob{ 0 };
+
+    std::mutex mReadyMutex;
+    std::vector<int> mReady;
+    int mUploaded = 0;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "game.h"
+
+#include <vector>
+
+// Live coverage heatmap for the strategy phase.
+// Every grass tile stores how much of the enemy path a turret placed there would cover
+// that is not already covered by a placed turret. The path is sampled into a SoA buffer
+// and distance tests run 4 samples at a time with SSE2 (scalar fallback elsewhere).
+// Placing or removing a turret only touches the samples inside its range and the tiles
+// within 2 * TURRET_RANGE of it, instead of recomputing tiles x path.
+class CoverageMap
+{
+public:
+    // Samples the waypoint polyline and computes the heat of every grass tile with no turrets placed.
+    void Build(const std::vector<Cell>& waypoints, int tiles[TILE_COUNT][TILE_COUNT]);
+
+    // Forgets all placed turrets.
+    void Reset();
+
+    void AddTurret(Vector2 position);
+    void RemoveTurret(Vector2 position);
+
+    // Seconds of enemy time-in-range per pixel of covered path (sum of 1 / speed over the wave).
+    void SetDwellPerPixel(float dwellPerPixel) { mDwellPerPixel = dwellPerPixel; }
+
+    // Uncovered path length (pixels) within range of the tile's center.
+    float PathCovered(int row, int col) const { return mHeat[row * TILE_COUNT + col]; }
+
+    // Expected enemy seconds spent within range of the tile's center on uncovered path.
+    float DwellTime(int row, int col) const { return PathCovered(row, col) * mDwellPerPixel; }
+
+    void Draw() const;
+
+private:
+    void ApplyDelta(Vector2 position, int coverDelta);
+    void RecomputeAll();
+
+    // Path samples, padded to a multiple of 4 so the SIMD loop needs no tail.
+    // mWeight is the sample's path length (mLength) while uncovered and 0 once a turret covers it.
+    std::vector<float> mX;
+    std::vector<float> mY;
+    std::vector<float> mWeight;
+    std::vector<float> mLength;
+    std::vector<int> mCoverCount;
+    int mSampleCount = 0;
+
+    std::vector<float> mHeat;
+    float mMaxHeat = 0.0f;
+    float mDwellPerPixel = 0.0f;
+    bool mGrass[TILE_COUNT][TILE_COUNT] = {};
+};
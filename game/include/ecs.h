@@ -0,0 +1,426 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Archetype-based entity component system.
+//
+// Entities with the same set of components share an Archetype. Each archetype stores its
+// rows in fixed-size chunks, one tightly packed array per component inside every chunk, so
+// a query walks plain arrays. Rows stay dense: destroying an entity moves the archetype's
+// last row into the hole.
+//
+// Components must be trivially copyable; rows are moved with memcpy. Entities get all their
+// components when they're created (there's no add/remove component yet).
+//
+// Structural changes (Create/Destroy) aren't allowed while a query is running. Queue them
+// on a CommandBuffer instead and Flush() it afterwards. A CommandBuffer has a single writer:
+// when a query is split across worker threads, give each worker its own buffer and flush
+// them all on the main thread once the workers are done.
+namespace ecs
+{
+    constexpr int MAX_COMPONENTS = 32;
+    constexpr size_t CHUNK_BYTES = 16 * 1024;
+
+    using Signature = uint32_t;
+
+    struct Entity
+    {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const Entity& other) const { return !(*this == other); }
+    };
+
+    namespace detail
+    {
+        inline int NextComponentId()
+        {
+            static std::atomic<int> next{ 0 };
+            return next++;
+        }
+
+        template <typename T>
+        int ComponentId()
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "ECS components are moved with memcpy");
+            static const int id = NextComponentId();
+            return id;
+        }
+
+        template <typename... Ts>
+        Signature SignatureOf()
+        {
+            Signature signature = 0;
+            int ids[] = { ComponentId<Ts>()... };
+            for (int id : ids)
+                signature |= 1u << id;
+            return signature;
+        }
+
+        inline size_t AlignUp(size_t value)
+        {
+            return (value + 15) & ~size_t(15);
+        }
+    }
+
+    class Archetype
+    {
+    public:
+        Archetype(Signature signature, const std::vector<std::pair<int, size_t>>& components)
+            : mSignature(signature)
+        {
+            mColumn.fill(-1);
+            size_t rowBytes = sizeof(Entity);
+            for (const auto& component : components)
+                rowBytes += component.second;
+            mCapacity = std::max<size_t>(1, CHUNK_BYTES / rowBytes);
+
+            // Chunk layout: [entities][column 0][column 1]...
+            size_t offset = detail::AlignUp(mCapacity * sizeof(Entity));
+            for (const auto& component : components)
+            {
+                mColumn[component.first] = (int)mSizes.size();
+                mSizes.push_back(component.second);
+                mOffsets.push_back(offset);
+                offset += detail::AlignUp(mCapacity * component.second);
+            }
+            mChunkBytes = offset;
+        }
+
+        Signature GetSignature() const { return mSignature; }
+        size_t Count() const { return mCount; }
+        size_t ChunkCapacity() const { return mCapacity; }
+        size_t ChunkCount() const { return (mCount + mCapacity - 1) / mCapacity; }
+        size_t RowsInChunk(size_t chunk) const { return std::min(mCapacity, mCount - chunk * mCapacity); }
+
+        Entity* Entities(size_t chunk) { return (Entity*)mChunks[chunk].get(); }
+
+        template <typename T>
+        T* Column(size_t chunk)
+        {
+            return (T*)(mChunks[chunk].get() + mOffsets[mColumn[detail::ComponentId<T>()]]);
+        }
+
+        // Appends an uninitialised row and returns its index.
+        size_t PushRow(Entity entity)
+        {
+            size_t row = mCount++;
+            size_t chunk = row / mCapacity;
+            // Chunks are kept after the archetype shrinks, so refilling doesn't allocate.
+            if (chunk == mChunks.size())
+                mChunks.emplace_back(new unsigned char[mChunkBytes]);
+            Entities(chunk)[row % mCapacity] = entity;
+            return row;
+        }
+
+        void* ComponentAt(int componentId, size_t row)
+        {
+            int column = mColumn[componentId];
+            return mChunks[row / mCapacity].get() + mOffsets[column] + (row % mCapacity) * mSizes[column];
+        }
+
+        Entity EntityAt(size_t row) { return Entities(row / mCapacity)[row % mCapacity]; }
+
+        // Removes a row by moving the last row into it. Returns the entity that moved (or an invalid one).
+        Entity RemoveRow(size_t row)
+        {
+            size_t last = --mCount;
+            if (row == last)
+                return Entity{};
+
+            unsigned char* to = mChunks[row / mCapacity].get();
+            unsigned char* from = mChunks[last / mCapacity].get();
+            for (size_t column = 0; column < mSizes.size(); column++)
+            {
+                memcpy(to + mOffsets[column] + (row % mCapacity) * mSizes[column],
+                    from + mOffsets[column] + (last % mCapacity) * mSizes[column], mSizes[column]);
+            }
+            Entity moved = EntityAt(last);
+            Entities(row / mCapacity)[row % mCapacity] = moved;
+            return moved;
+        }
+
+        void Clear() { mCount = 0; }
+
+    private:
+        Signature mSignature;
+        std::array<int, MAX_COMPONENTS> mColumn;
+        std::vector<size_t> mSizes;
+        std::vector<size_t> mOffsets;
+        size_t mCapacity = 0;
+        size_t mChunkBytes = 0;
+        size_t mCount = 0;
+        std::vector<std::unique_ptr<unsigned char[]>> mChunks;
+    };
+
+    class Registry;
+
+    class CommandBuffer
+    {
+    public:
+        // Components are copied into a byte buffer, so queueing a spawn doesn't allocate
+        // once the buffer has grown to its working size.
+        template <typename... Ts>
+        void Spawn(const Ts&... components)
+        {
+            size_t offset = mSpawnBytes.size();
+            const void* sources[] = { &components... };
+            size_t sizes[] = { sizeof(Ts)... };
+            mSpawnBytes.resize(offset + (sizeof(Ts) + ...));
+            for (size_t i = 0, at = offset; i < sizeof...(Ts); at += sizes[i], i++)
+                memcpy(mSpawnBytes.data() + at, sources[i], sizes[i]);
+            mSpawns.push_back({ &CreateFromBytes<Ts...>, offset });
+        }
+
+        void Despawn(Entity entity)
+        {
+            mDespawns.push_back(entity);
+        }
+
+        bool IsEmpty() const { return mSpawns.empty() && mDespawns.empty(); }
+
+    private:
+        friend class Registry;
+
+        template <typename... Ts>
+        static void CreateFromBytes(Registry& registry, const unsigned char* bytes);
+
+        struct SpawnCommand
+        {
+            void (*create)(Registry&, const unsigned char*);
+            size_t offset;
+        };
+
+        std::vector<SpawnCommand> mSpawns;
+        std::vector<unsigned char> mSpawnBytes;
+        std::vector<Entity> mDespawns;
+    };
+
+    class Registry
+    {
+    public:
+        template <typename... Ts>
+        Entity Create(const Ts&... components)
+        {
+            const void* sources[] = { &components... };
+            return CreateFrom<Ts...>(sources);
+        }
+
+        // Create() with the components given as one pointer per component, in Ts order.
+        template <typename... Ts>
+        Entity CreateFrom(const void* const* sources)
+        {
+            Archetype& archetype = FindOrCreateArchetype<Ts...>();
+            Entity entity = AllocateEntity();
+            size_t row = archetype.PushRow(entity);
+            int ids[] = { detail::ComponentId<Ts>()... };
+            size_t sizes[] = { sizeof(Ts)... };
+            for (size_t i = 0; i < sizeof...(Ts); i++)
+                memcpy(archetype.ComponentAt(ids[i], row), sources[i], sizes[i]);
+
+            Record& record = mRecords[entity.index];
+            record.archetype = &archetype;
+            record.row = row;
+            return entity;
+        }
+
+        // Creates count single-component entities, copying whole runs of components per chunk.
+        template <typename T>
+        void CreateMany(const T* components, size_t count)
+        {
+            Archetype& archetype = FindOrCreateArchetype<T>();
+            for (size_t i = 0; i < count; i++)
+            {
+                Entity entity = AllocateEntity();
+                size_t row = archetype.PushRow(entity);
+                mRecords[entity.index].archetype = &archetype;
+                mRecords[entity.index].row = row;
+            }
+            size_t first = archetype.Count() - count;
+            for (size_t done = 0; done < count;)
+            {
+                size_t row = first + done;
+                size_t chunk = row / archetype.ChunkCapacity();
+                size_t offset = row % archetype.ChunkCapacity();
+                size_t run = std::min(count - done, archetype.ChunkCapacity() - offset);
+                memcpy(archetype.Column<T>(chunk) + offset, components + done, run * sizeof(T));
+                done += run;
+            }
+        }
+
+        void Destroy(Entity entity)
+        {
+            if (!IsAlive(entity))
+                return;
+
+            Record& record = mRecords[entity.index];
+            Entity moved = record.archetype->RemoveRow(record.row);
+            if (moved.index != UINT32_MAX)
+                mRecords[moved.index].row = record.row;
+
+            record.archetype = nullptr;
+            record.generation++;
+            mFreeIndices.push_back(entity.index);
+        }
+
+        bool IsAlive(Entity entity) const
+        {
+            return entity.index < mRecords.size() && mRecords[entity.index].archetype != nullptr &&
+                mRecords[entity.index].generation == entity.generation;
+        }
+
+        template <typename T>
+        T* Get(Entity entity)
+        {
+            if (!IsAlive(entity))
+                return nullptr;
+            const Record& record = mRecords[entity.index];
+            if ((record.archetype->GetSignature() & detail::SignatureOf<T>()) == 0)
+                return nullptr;
+            return (T*)record.archetype->ComponentAt(detail::ComponentId<T>(), record.row);
+        }
+
+        // Number of entities that have all of Ts.
+        template <typename... Ts>
+        size_t Count() const
+        {
+            const Signature mask = detail::SignatureOf<Ts...>();
+            size_t count = 0;
+            for (const auto& archetype : mArchetypes)
+            {
+                if ((archetype->GetSignature() & mask) == mask)
+                    count += archetype->Count();
+            }
+            return count;
+        }
+
+        // f(Ts&...) for every entity that has all of Ts.
+        template <typename... Ts, typename F>
+        void Each(F&& f)
+        {
+            EachChunk<Ts...>([&](size_t count, Entity*, Ts*... columns)
+            {
+                for (size_t i = 0; i < count; i++)
+                    f(columns[i]...);
+            });
+        }
+
+        // f(Entity, Ts&...) for every entity that has all of Ts.
+        template <typename... Ts, typename F>
+        void EachEntity(F&& f)
+        {
+            EachChunk<Ts...>([&](size_t count, Entity* entities, Ts*... columns)
+            {
+                for (size_t i = 0; i < count; i++)
+                    f(entities[i], columns[i]...);
+            });
+        }
+
+        // f(count, Entity*, Ts*...) once per chunk, for hand-written or vectorised loops.
+        template <typename... Ts, typename F>
+        void EachChunk(F&& f)
+        {
+            const Signature mask = detail::SignatureOf<Ts...>();
+            for (const auto& archetype : mArchetypes)
+            {
+                if ((archetype->GetSignature() & mask) != mask)
+                    continue;
+                for (size_t chunk = 0; chunk < archetype->ChunkCount(); chunk++)
+                    f(archetype->RowsInChunk(chunk), archetype->Entities(chunk), archetype->template Column<Ts>(chunk)...);
+            }
+        }
+
+        // Applies queued despawns, then queued spawns, and empties the buffer.
+        void Flush(CommandBuffer& commands)
+        {
+            for (Entity entity : commands.mDespawns)
+                Destroy(entity);
+            for (const CommandBuffer::SpawnCommand& spawn : commands.mSpawns)
+                spawn.create(*this, commands.mSpawnBytes.data() + spawn.offset);
+            commands.mDespawns.clear();
+            commands.mSpawns.clear();
+            commands.mSpawnBytes.clear();
+        }
+
+        // Destroys every entity but keeps archetypes and chunk memory for reuse.
+        void Clear()
+        {
+            for (auto& archetype : mArchetypes)
+                archetype->Clear();
+            mFreeIndices.clear();
+            for (uint32_t i = 0; i < (uint32_t)mRecords.size(); i++)
+            {
+                if (mRecords[i].archetype != nullptr)
+                {
+                    mRecords[i].archetype = nullptr;
+                    mRecords[i].generation++;
+                }
+                mFreeIndices.push_back(i);
+            }
+        }
+
+    private:
+        struct Record
+        {
+            Archetype* archetype = nullptr;
+            size_t row = 0;
+            uint32_t generation = 0;
+        };
+
+        Entity AllocateEntity()
+        {
+            Entity entity;
+            if (!mFreeIndices.empty())
+            {
+                entity.index = mFreeIndices.back();
+                mFreeIndices.pop_back();
+            }
+            else
+            {
+                entity.index = (uint32_t)mRecords.size();
+                mRecords.emplace_back();
+            }
+            entity.generation = mRecords[entity.index].generation;
+            return entity;
+        }
+
+        template <typename... Ts>
+        Archetype& FindOrCreateArchetype()
+        {
+            const Signature signature = detail::SignatureOf<Ts...>();
+            auto found = mArchetypeBySignature.find(signature);
+            if (found != mArchetypeBySignature.end())
+                return *mArchetypes[found->second];
+
+            std::vector<std::pair<int, size_t>> components = { { detail::ComponentId<Ts>(), sizeof(Ts) }... };
+            std::sort(components.begin(), components.end());
+            mArchetypeBySignature[signature] = mArchetypes.size();
+            mArchetypes.emplace_back(new Archetype(signature, components));
+            return *mArchetypes.back();
+        }
+
+        std::vector<std::unique_ptr<Archetype>> mArchetypes;
+        std::unordered_map<Signature, size_t> mArchetypeBySignature;
+        std::vector<Record> mRecords;
+        std::vector<uint32_t> mFreeIndices;
+    };
+
+    template <typename... Ts>
+    void CommandBuffer::CreateFromBytes(Registry& registry, const unsigned char* bytes)
+    {
+        size_t sizes[] = { sizeof(Ts)... };
+        const void* sources[sizeof...(Ts)];
+        for (size_t i = 0, at = 0; i < sizeof...(Ts); at += sizes[i], i++)
+            sources[i] = bytes + at;
+        registry.CreateFrom<Ts...>(sources);
+    }
+}
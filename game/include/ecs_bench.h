@@ -0,0 +1,5 @@
+#pragma once
+
+// Times the old per-kind std::vector update/remove_if pattern against ecs::Registry
+// at 1k, 100k and 1M bullets and prints ms per frame. Run with "game --bench-ecs".
+int RunEcsBenchmark();
@@ -22,6 +22,157 @@ Use this as a starting point or replace it with your code.
 
 */
 
+#pragma once
+
+#include <raylib.h>
+#include <raymath.h>
+
+#include "ecs.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
 
 static constexpr int InitialWidth = 1200;
-static constexpr int InitialHeight = 800;
\ No newline at end of file
+static constexpr int InitialHeight = 800;
+
+constexpr float SCREEN_SIZE = 800;
+constexpr int TILE_COUNT = 20;
+constexpr float TILE_SIZE = SCREEN_SIZE / TILE_COUNT;
+
+constexpr float BULLET_RADIUS = 10.0f;
+constexpr float BULLET_SPEED = 400.0f;
+constexpr float BULLET_LIFE_TIME = 1.0f;
+constexpr int BULLET_DAMAGE = 25;// ---> damage for each bullet <---
+
+constexpr float TURRET_RADIUS = TILE_SIZE * 0.4f;// ---> added radius for turrets <---
+constexpr float TURRET_RANGE = 200.0f; //---> this defines the ranfe of the turrets <---
+constexpr float TURRET_SHOOT_COOLDOWN = 0.5f; //---> cooldown time for the turrets <---
+constexpr int MAX_TURRETS = 5;                   // ---> added number of maximum turrets <---
+constexpr float ENEMY_RADIUS = TILE_SIZE * 0.5f;// ---> radius for enemy <---
+
+// ---> simulation time is counted in ticks, timers fire on tick boundaries <---
+constexpr int TICKS_PER_SECOND = 1000;
+
+inline uint64_t SecondsToTicks(double seconds)
+{
+    return (uint64_t)(seconds * TICKS_PER_SECOND + 0.5);
+}
+
+// ---> combat always advances in fixed steps, fast-forward just runs more of them per frame <---
+constexpr uint64_t SIM_STEP_TICKS = 8;
+constexpr float SIM_DT = (float)SIM_STEP_TICKS / TICKS_PER_SECOND;
+constexpr int SIM_MAX_STEPS_PER_FRAME = 256;      // ---> backlog past this is dropped after a hitch <---
+constexpr double SIM_MAX_SPEED_BUDGET = 0.012;     // ---> seconds per frame spent stepping at max speed <---
+
+enum GameSpeed
+{
+    SPEED_1X,
+    SPEED_2X,
+    SPEED_4X,
+    SPEED_16X,
+    SPEED_MAX,
+    SPEED_COUNT
+};
+
+constexpr float GAME_SPEED_SCALE[SPEED_COUNT] = { 1.0f, 2.0f, 4.0f, 16.0f, 0.0f };
+
+enum TileType : int
+{
+    GRASS,      // Marks unoccupied space, can be overwritten 
+    DIRT,       // Marks the path, cannot be overwritten
+    WAYPOINT,   // Marks where the path turns, cannot be overwritten
+    COUNT
+};
+
+struct Cell
+{
+    int row;
+    int col;
+};
+
+constexpr std::array<Cell, 4> DIRECTIONS{ Cell{ -1, 0 }, Cell{ 1, 0 }, Cell{ 0, -1 }, Cell{ 0, 1 } };
+// --->added enums for different stages for game,for now adding just two phases <--- 
+enum GameState
+{
+	STRATEGY_PHASE,   //--->player will place turrets in this phase<---
+	COMBAT_PHASE,   //--->enemies will move and turrets will shoot in this phase<---
+    LEVEL_WON,
+    LEVEL_LOST
+};
+
+// --->we will define different types of enemy here<---
+enum EnemyType
+{
+    NORMAL, 
+	FAST,       // ---> will move faster than the normal one <---
+	HEAVY,      // ---> will move slowely but have more health <---
+};
+
+inline bool InBounds(Cell cell, int rows = TILE_COUNT, int cols = TILE_COUNT)
+{
+    return cell.col >= 0 && cell.col < cols && cell.row >= 0 && cell.row < rows;
+}
+
+inline Vector2 TileCenter(int row, int col)
+{
+    float x = col * TILE_SIZE + TILE_SIZE * 0.5f;
+    float y = row * TILE_SIZE + TILE_SIZE * 0.5f;
+    return { x, y };
+}
+
+struct Bullet
+{
+    Vector2 position = Vector2Zeros;
+    Vector2 previousPosition = Vector2Zeros; // ---> position one step ago, for drawing between steps <---
+    Vector2 direction = Vector2Zeros;
+    uint64_t expireTick = 0;
+    bool destroy = false;
+};
+
+// ---> added Turret struct <---
+struct Turret
+{
+    Vector2 position = { 0, 0 };
+    bool ready = true;       // ---> cooldown over, may shoot <---
+    uint64_t readyTick = 0;  // ---> when the running cooldown ends <---
+};
+// ---> added Enemy struct<---
+struct Enemy
+{
+    EnemyType type;
+    Vector2 position = { 0, 0 };
+    Vector2 previousPosition = { 0, 0 };
+    int health = 100;
+    float speed = 100.0f;
+    int waypointIndex = 0;
+    bool shouldBeDestroyed = false;
+};
+
+// ---> everything the simulation needs to continue from a given moment <---
+struct World
+{
+    GameState state = STRATEGY_PHASE;
+    int level = 1;
+    int enemiesToSpawn = 0;
+    int enemiesSpawned = 0;
+    uint64_t tick = 0;              // ---> combat time simulated so far <---
+    uint64_t nextSpawnTick = 0;
+    float spawnInterval = 1.0f;
+    std::vector<EnemyType> wave;
+    ecs::Registry entities;     // ---> Enemy, Bullet and Turret entities <---
+};
+
+// ---> what a timing wheel entry does when it comes due <---
+enum TimerKind
+{
+    TIMER_SPAWN,
+    TIMER_TURRET_READY,
+    TIMER_BULLET_EXPIRE,
+};
+
+struct GameTimer
+{
+    TimerKind kind = TIMER_SPAWN;
+    ecs::Entity entity;
+};
@@ -0,0 +1,6 @@
+#pragma once
+
+// Times raylib's CPU image operations (color tint/invert/contrast/brightness/replace,
+// grayscale, format conversions and alpha-blended ImageDraw) on a 3840x2160 RGBA8 and
+// grayscale image, in ms per call. Run with "game --bench-images".
+int RunImageBenchmark();
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+// Read-only memory mapping of a whole file.
+// Kept free of raylib.h because the Windows implementation needs <windows.h>.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const char* fileName);
+    void Close();
+
+    const unsigned char* Data() const { return mData; }
+    size_t Size() const { return mSize; }
+    bool IsOpen() const { return mData != nullptr; }
+
+private:
+    const unsigned char* mData = nullptr;
+    size_t mSize = 0;
+#if defined(_WIN32)
+    void* mFile = nullptr;
+    void* mMapping = nullptr;
+#endif
+};
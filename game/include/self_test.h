@@ -0,0 +1,7 @@
+#pragma once
+
+// Checks for the game's own data structures that don't need a window: snapshot files and
+// asset archives rejected when their header doesn't match their contents, timers firing on
+// their due tick, and so on. Prints one line per failed check and returns the number of
+// failures. Run with "game --self-test".
+int RunSelfTests();
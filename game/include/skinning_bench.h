@@ -0,0 +1,6 @@
+#pragma once
+
+// Times CPU skinning of one 64-bone mesh at 10k, 100k and 1M vertices: the old per-influence
+// Vector3Transform loop against UpdateModelAnimationEx with and without normals, in ms per
+// frame. Run with "game --bench-skinning".
+int RunSkinningBenchmark();
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "game.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Versioned binary copy of a World.
+// The layout is a fixed header, the scalar state, then every entity array as raw bytes,
+// so capturing and restoring are a handful of memcpy calls into a buffer that is
+// allocated up front and only grows if a capture ever outgrows it.
+class Snapshot
+{
+public:
+    static constexpr uint32_t MAGIC = 0x53534454; // "TDSS"
+    static constexpr uint32_t VERSION = 3;
+
+    // Reserves room for a world with up to this many entities of each kind.
+    explicit Snapshot(size_t entityCapacity = 1024);
+
+    void Capture(World& world);
+
+    // Returns false (and leaves world untouched) if the snapshot is empty or from another version.
+    bool Restore(World& world) const;
+
+    bool IsValid() const;
+    void Clear() { mSize = 0; }
+
+    bool SaveToFile(const char* fileName) const;
+    bool LoadFromFile(const char* fileName);
+
+    const unsigned char* Data() const { return mBuffer.data(); }
+    size_t Size() const { return mSize; }
+
+private:
+    std::vector<unsigned char> mBuffer;
+    size_t mSize = 0;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <raylib.h>
+
+#include <string>
+#include <vector>
+
+// Longest text TextRun::Format() can produce, it formats into a stack buffer of this size.
+constexpr int TEXT_RUN_MAX_LENGTH = 128;
+
+// printf into a caller-owned buffer, always terminated and truncated to size - 1.
+// Returns the length written. Unlike TextFormat() it doesn't clear a 1 KB static buffer first.
+int FormatText(char* buffer, int size, const char* format, ...);
+
+// A line of HUD text laid out once and drawn from cached glyph quads.
+// Set()/Format() compare against the cached text and only decode UTF-8, look up glyphs and
+// rebuild quads when the text, font or placement changed. Draw() hands all quads to the
+// render batch in one rlVertexQuads2f() call instead of one DrawTexturePro() per glyph.
+class TextRun
+{
+public:
+    // Same placement as DrawText(): default font, spacing of fontSize / 10.
+    void Set(const char* text, int posX, int posY, int fontSize);
+    void Set(Font font, const char* text, Vector2 position, float fontSize, float spacing);
+
+    // Formats into a stack buffer first, so an unchanged value costs a vsnprintf and a compare.
+    void Format(int posX, int posY, int fontSize, const char* format, ...);
+
+    void Draw(Color tint) const;
+
+    const char* Text() const { return mText.c_str(); }
+
+private:
+    void Rebuild();
+
+    std::string mText;
+    Font mFont = {};
+    Vector2 mPosition = {};
+    float mFontSize = 0.0f;
+    float mSpacing = 0.0f;
+    bool mBuilt = false;
+
+    // 4 vertices per glyph quad, XY positions and UV texcoords.
+    std::vector<float> mVertices;
+    std::vector<float> mTexcoords;
+};
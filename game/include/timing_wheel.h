@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Hierarchical timing wheel.
+//
+// Timers are registered with an absolute due tick and sit in one slot of one level:
+// level 0 has a slot per tick for the next 256 ticks, and each higher level has 64 slots
+// that each cover 64x the span of the level below. When level 0 wraps, the next slot of
+// level 1 is cascaded down (and so on), so every timer is moved at most once per level.
+// Advancing the wheel only visits the current slot of each tick and the timers that are
+// actually due, not every registered timer.
+//
+// Nodes live in a pool with a free list, so scheduling doesn't allocate once the pool has
+// grown to the peak number of live timers.
+template <typename Payload>
+class TimingWheel
+{
+public:
+    struct Handle
+    {
+        uint32_t index = NONE;
+        uint32_t generation = 0;
+    };
+
+    explicit TimingWheel(uint64_t now = 0)
+    {
+        Reset(now);
+    }
+
+    // Drops every timer and restarts the clock at now.
+    void Reset(uint64_t now)
+    {
+        mNow = now;
+        mNodes.clear();
+        mFree.clear();
+        for (uint32_t& head : mHeads)
+            head = NONE;
+        mCount = 0;
+    }
+
+    uint64_t Now() const { return mNow; }
+    size_t Count() const { return mCount; }
+
+    // Timers already due (due <= Now()) fire on the next tick.
+    Handle Schedule(uint64_t due, const Payload& payload)
+    {
+        uint32_t index;
+        if (!mFree.empty())
+        {
+            index = mFree.back();
+            mFree.pop_back();
+        }
+        else
+        {
+            index = (uint32_t)mNodes.size();
+            mNodes.emplace_back();
+        }
+
+        Node& node = mNodes[index];
+        node.due = due;
+        node.payload = payload;
+        node.active = true;
+        Link(index, mNow + 1);
+        mCount++;
+        return Handle{ index, node.generation };
+    }
+
+    // Returns false if the timer already fired or was cancelled.
+    bool Cancel(Handle handle)
+    {
+        if (handle.index >= mNodes.size())
+            return false;
+        Node& node = mNodes[handle.index];
+        if (!node.active || node.generation != handle.generation)
+            return false;
+        Unlink(handle.index);
+        Release(handle.index);
+        return true;
+    }
+
+    // Moves the clock to target, calling onExpire(dueTick, payload) for every timer that comes due,
+    // in tick order. onExpire may schedule and cancel timers.
+    template <typename F>
+    void Advance(uint64_t target, F&& onExpire)
+    {
+        while (mNow < target)
+        {
+            if (mCount == 0)
+            {
+                mNow = target;
+                return;
+            }
+
+            mNow++;
+            Cascade();
+
+            uint32_t& slot = mHeads[SlotIndex(0, mNow)];
+            if (slot == NONE)
+                continue;
+
+            // Detach the slot so callbacks can schedule into it safely.
+            mHeads[FIRING] = slot;
+            slot = NONE;
+            for (uint32_t index = mHeads[FIRING]; index != NONE; index = mHeads[FIRING])
+            {
+                mHeads[FIRING] = mNodes[index].next;
+                if (mHeads[FIRING] != NONE)
+                    mNodes[mHeads[FIRING]].prev = NONE;
+
+                uint64_t due = mNodes[index].due;
+                Payload payload = mNodes[index].payload;
+                Release(index);
+                onExpire(due, payload);
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr int LEVEL0_BITS = 8;
+    static constexpr int LEVEL_BITS = 6;
+    static constexpr int LEVELS = 4;
+    static constexpr uint32_t LEVEL0_SLOTS = 1u << LEVEL0_BITS;
+    static constexpr uint32_t LEVEL_SLOTS = 1u << LEVEL_BITS;
+    static constexpr uint32_t SLOT_COUNT = LEVEL0_SLOTS + (LEVELS - 1) * LEVEL_SLOTS;
+    // Extra list head for the slot currently being fired.
+    static constexpr uint32_t FIRING = SLOT_COUNT;
+
+    struct Node
+    {
+        uint64_t due = 0;
+        Payload payload{};
+        uint32_t next = NONE;
+        uint32_t prev = NONE;
+        uint32_t list = NONE;
+        uint32_t generation = 0;
+        bool active = false;
+    };
+
+    static int Shift(int level)
+    {
+        return level == 0 ? 0 : LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+    }
+
+    static uint32_t SlotIndex(int level, uint64_t tick)
+    {
+        if (level == 0)
+            return (uint32_t)(tick & (LEVEL0_SLOTS - 1));
+        return LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS + (uint32_t)((tick >> Shift(level)) & (LEVEL_SLOTS - 1));
+    }
+
+    // Files the node by its due tick, clamped to no earlier than earliest. New timers use
+    // Now() + 1; cascaded timers may land in the current tick's slot, which fires next.
+    void Link(uint32_t index, uint64_t earliest)
+    {
+        Node& node = mNodes[index];
+        uint64_t due = node.due > earliest ? node.due : earliest;
+        uint64_t delta = due - mNow;
+
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (1ull << Shift(level + 1)))
+            level++;
+        // Beyond the top level's span, park the timer in the farthest slot; it cascades down again later.
+        if (level == LEVELS - 1 && delta >= (1ull << (Shift(LEVELS - 1) + LEVEL_BITS)))
+            due = mNow + (1ull << (Shift(LEVELS - 1) + LEVEL_BITS)) - 1;
+
+        uint32_t list = SlotIndex(level, due);
+        node.list = list;
+        node.prev = NONE;
+        node.next = mHeads[list];
+        if (node.next != NONE)
+            mNodes[node.next].prev = index;
+        mHeads[list] = index;
+    }
+
+    void Unlink(uint32_t index)
+    {
+        Node& node = mNodes[index];
+        if (node.prev != NONE)
+            mNodes[node.prev].next = node.next;
+        else
+            mHeads[node.list] = node.next;
+        if (node.next != NONE)
+            mNodes[node.next].prev = node.prev;
+        node.next = node.prev = NONE;
+    }
+
+    void Release(uint32_t index)
+    {
+        Node& node = mNodes[index];
+        node.active = false;
+        node.generation++;
+        node.list = NONE;
+        mFree.push_back(index);
+        mCount--;
+    }
+
+    // When a lower level wraps around, re-file the next slot of the level above it.
+    void Cascade()
+    {
+        for (int level = 1; level < LEVELS; level++)
+        {
+            if ((mNow & ((1ull << Shift(level)) - 1)) != 0)
+                return;
+
+            uint32_t list = SlotIndex(level, mNow);
+            uint32_t index = mHeads[list];
+            mHeads[list] = NONE;
+            while (index != NONE)
+            {
+                uint32_t next = mNodes[index].next;
+                Link(index, mNow);
+                index = next;
+            }
+        }
+    }
+
+    uint64_t mNow = 0;
+    std::vector<Node> mNodes;
+    std::vector<uint32_t> mFree;
+    uint32_t mHeads[SLOT_COUNT + 1];
+    size_t mCount = 0;
+};
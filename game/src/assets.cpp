@@ -0,0 +1,273 @@
+#include "assets.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t PACK_MAGIC = 0x4B504454; // "TDPK"
+    constexpr uint32_t PACK_VERSION = 1;
+    constexpr uint64_t PACK_ALIGNMENT = 64;
+
+    enum PackKind : uint32_t
+    {
+        PACK_TEXTURE = 1,
+        PACK_SOUND = 2,
+    };
+
+    struct PackHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t reserved;
+    };
+
+    // Largest texture side accepted from an archive, keeps GetPixelDataSize() within int range.
+    constexpr uint32_t PACK_MAX_TEXTURE_SIZE = 8192;
+
+    uint64_t AlignUp(uint64_t value)
+    {
+        return (value + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+    }
+
+    // Bytes GetImage()/GetWave() hand out for an entry, from its params alone.
+    // Returns false if the params can't describe a packed asset.
+    bool EntryDataSize(const AssetArchive::Entry& entry, uint64_t* size)
+    {
+        *size = 0;
+        if (entry.kind == PACK_TEXTURE)
+        {
+            uint32_t width = entry.param[0], height = entry.param[1], format = entry.param[2], mipmaps = entry.param[3];
+            if (width == 0 || height == 0 || width > PACK_MAX_TEXTURE_SIZE || height > PACK_MAX_TEXTURE_SIZE ||
+                format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE || format > PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA || mipmaps == 0 || mipmaps > 32)
+                return false;
+            for (uint32_t level = 0; level < mipmaps; level++)
+            {
+                *size += GetPixelDataSize((int)width, (int)height, (int)format);
+                width = width > 1 ? width / 2 : 1;
+                height = height > 1 ? height / 2 : 1;
+            }
+            return true;
+        }
+        if (entry.kind == PACK_SOUND)
+        {
+            uint32_t sampleSize = entry.param[2], channels = entry.param[3];
+            if ((sampleSize != 8 && sampleSize != 16 && sampleSize != 32) || channels == 0 || channels > 8)
+                return false;
+            *size = (uint64_t)entry.param[0] * channels * (sampleSize / 8);
+            return true;
+        }
+        return false;
+    }
+
+    // DXT1 for opaque sprites, DXT5 for anything with transparency. DXT1 punch-through would
+    // halve cut-outs again, but it stores black in transparent texels, which shows as dark fringes.
+    int CompressedFormat(const Image& image)
+    {
+        const unsigned char* pixels = (const unsigned char*)image.data;
+        for (int i = 0; i < image.width * image.height; i++)
+        {
+            if (pixels[i * 4 + 3] != 255)
+                return PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+        }
+        return PIXELFORMAT_COMPRESSED_DXT1_RGB;
+    }
+}
+
+bool PackAssets(const char* archiveName, const char* const* fileNames, int fileCount)
+{
+    std::vector<AssetArchive::Entry> entries(fileCount);
+    std::vector<unsigned char> payload;
+    uint64_t dataStart = AlignUp(sizeof(PackHeader) + fileCount * sizeof(AssetArchive::Entry));
+
+    for (int i = 0; i < fileCount; i++)
+    {
+        AssetArchive::Entry& entry = entries[i];
+        memset(&entry, 0, sizeof(entry));
+        if (strlen(fileNames[i]) >= sizeof(entry.name))
+        {
+            TraceLog(LOG_WARNING, "PACK: [%s] Name too long for the archive", fileNames[i]);
+            return false;
+        }
+        strcpy(entry.name, fileNames[i]);
+
+        const void* data = nullptr;
+        uint64_t size = 0;
+        Image image = { 0 };
+        Wave wave = { 0 };
+        if (IsFileExtension(fileNames[i], ".png"))
+        {
+            image = LoadImage(fileNames[i]);
+            if (!IsImageValid(image))
+                return false;
+            // No mip chain: sprites are drawn at their own size and stay point-sampled,
+            // a texture with mipmaps gets trilinear filtering from rlLoadTexture().
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            ImageFormat(&image, CompressedFormat(image));
+            entry.kind = PACK_TEXTURE;
+            entry.param[0] = image.width;
+            entry.param[1] = image.height;
+            entry.param[2] = image.format;
+            entry.param[3] = image.mipmaps;
+            data = image.data;
+            size = GetPixelDataSize(image.width, image.height, image.format);
+        }
+        else if (IsFileExtension(fileNames[i], ".wav"))
+        {
+            wave = LoadWave(fileNames[i]);
+            if (!IsWaveValid(wave))
+                return false;
+            WaveFormat(&wave, PACK_SAMPLE_RATE, 32, 2);
+            entry.kind = PACK_SOUND;
+            entry.param[0] = wave.frameCount;
+            entry.param[1] = wave.sampleRate;
+            entry.param[2] = wave.sampleSize;
+            entry.param[3] = wave.channels;
+            data = wave.data;
+            size = (uint64_t)wave.frameCount * wave.channels * (wave.sampleSize / 8);
+        }
+        else
+        {
+            TraceLog(LOG_WARNING, "PACK: [%s] Unsupported asset type", fileNames[i]);
+            return false;
+        }
+
+        entry.offset = dataStart + payload.size();
+        entry.size = size;
+        payload.insert(payload.end(), (const unsigned char*)data, (const unsigned char*)data + size);
+        payload.resize(AlignUp(payload.size()), 0);
+
+        if (image.data != nullptr)
+            UnloadImage(image);
+        if (wave.data != nullptr)
+            UnloadWave(wave);
+    }
+
+    PackHeader header = { PACK_MAGIC, PACK_VERSION, (uint32_t)fileCount, 0 };
+    std::vector<unsigned char> archive(dataStart, 0);
+    memcpy(archive.data(), &header, sizeof(header));
+    if (fileCount > 0)
+        memcpy(archive.data() + sizeof(header), entries.data(), fileCount * sizeof(AssetArchive::Entry));
+    archive.insert(archive.end(), payload.begin(), payload.end());
+
+    if (!SaveFileData(archiveName, archive.data(), (int)archive.size()))
+        return false;
+    TraceLog(LOG_INFO, "PACK: [%s] Packed %i assets (%i bytes)", archiveName, fileCount, (int)archive.size());
+    return true;
+}
+
+bool AssetArchive::Open(const char* fileName)
+{
+    Close();
+    if (!mFile.Open(fileName))
+        return false;
+
+    PackHeader header;
+    if (mFile.Size() < sizeof(header))
+    {
+        Close();
+        return false;
+    }
+    memcpy(&header, mFile.Data(), sizeof(header));
+    uint64_t tableEnd = sizeof(header) + (uint64_t)header.entryCount * sizeof(Entry);
+    if (header.magic != PACK_MAGIC || header.version != PACK_VERSION || tableEnd > mFile.Size())
+    {
+        TraceLog(LOG_WARNING, "PACK: [%s] Not a valid asset archive", fileName);
+        Close();
+        return false;
+    }
+
+    const Entry* entries = (const Entry*)(mFile.Data() + sizeof(header));
+    for (uint32_t i = 0; i < header.entryCount; i++)
+    {
+        const Entry& entry = entries[i];
+        if (memchr(entry.name, '\0', sizeof(entry.name)) == nullptr)
+        {
+            TraceLog(LOG_WARNING, "PACK: [%s] Entry %i has an unterminated name", fileName, (int)i);
+            Close();
+            return false;
+        }
+
+        // Written so offset + size can't wrap around.
+        if (entry.offset < tableEnd || entry.offset > mFile.Size() || entry.size > mFile.Size() - entry.offset)
+        {
+            TraceLog(LOG_WARNING, "PACK: [%s] Entry [%s] is truncated", fileName, entry.name);
+            Close();
+            return false;
+        }
+        uint64_t dataSize = 0;
+        if (!EntryDataSize(entry, &dataSize) || dataSize > entry.size)
+        {
+            TraceLog(LOG_WARNING, "PACK: [%s] Entry [%s] doesn't match its data size", fileName, entry.name);
+            Close();
+            return false;
+        }
+    }
+
+    mEntries = entries;
+    mEntryCount = header.entryCount;
+    TraceLog(LOG_INFO, "PACK: [%s] Mapped %i assets", fileName, mEntryCount);
+    return true;
+}
+
+void AssetArchive::Close()
+{
+    mFile.Close();
+    mEntries = nullptr;
+    mEntryCount = 0;
+}
+
+const AssetArchive::Entry* AssetArchive::Find(const char* fileName, uint32_t kind) const
+{
+    for (uint32_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].kind == kind && strncmp(mEntries[i].name, fileName, sizeof(mEntries[i].name)) == 0)
+            return &mEntries[i];
+    }
+    return nullptr;
+}
+
+bool AssetArchive::GetImage(const char* fileName, Image* image) const
+{
+    const Entry* entry = Find(fileName, PACK_TEXTURE);
+    if (entry == nullptr)
+        return false;
+
+    image->data = (void*)(mFile.Data() + entry->offset);
+    image->width = entry->param[0];
+    image->height = entry->param[1];
+    image->format = entry->param[2];
+    image->mipmaps = entry->param[3];
+    return true;
+}
+
+bool AssetArchive::GetWave(const char* fileName, Wave* wave) const
+{
+    const Entry* entry = Find(fileName, PACK_SOUND);
+    if (entry == nullptr)
+        return false;
+
+    wave->data = (void*)(mFile.Data() + entry->offset);
+    wave->frameCount = entry->param[0];
+    wave->sampleRate = entry->param[1];
+    wave->sampleSize = entry->param[2];
+    wave->channels = entry->param[3];
+    return true;
+}
+
+Texture2D AssetArchive::LoadTexture(const char* fileName) const
+{
+    Image image;
+    if (GetImage(fileName, &image))
+        return LoadTextureFromImage(image);
+    return ::LoadTexture(fileName);
+}
+
+Sound AssetArchive::LoadSound(const char* fileName) const
+{
+    Wave wave;
+    if (GetWave(fileName, &wave))
+        return LoadSoundFromWave(wave);
+    return ::LoadSound(fileName);
+}
@@ -0,0 +1,125 @@
+#include "async_loader.h"
+
+#include <algorithm>
+
+AsyncAssetLoader::AsyncAssetLoader(const AssetArchive& archive)
+    : mArchive(archive)
+{
+}
+
+AsyncAssetLoader::~AsyncAssetLoader()
+{
+    Shutdown();
+}
+
+void AsyncAssetLoader::Shutdown()
+{
+    // Workers finish the job they hold and then find nothing left to claim.
+    mNextJob = (int)mJobs.size();
+    for (std::thread& worker : mWorkers)
+        worker.join();
+    mWorkers.clear();
+
+    // Free anything that was decoded but never uploaded.
+    std::lock_guard<std::mutex> lock(mReadyMutex);
+    for (int index : mReady)
+    {
+        Job& job = mJobs[index];
+        if (!job.ownsData)
+            continue;
+        if (job.image.data != nullptr)
+            UnloadImage(job.image);
+        if (job.wave.data != nullptr)
+            UnloadWave(job.wave);
+    }
+    mReady.clear();
+}
+
+void AsyncAssetLoader::RequestTexture(const char* fileName, Texture2D* target)
+{
+    Job job;
+    job.fileName = fileName;
+    job.texture = target;
+    mJobs.push_back(job);
+}
+
+void AsyncAssetLoader::RequestSound(const char* fileName, Sound* target)
+{
+    Job job;
+    job.fileName = fileName;
+    job.sound = target;
+    mJobs.push_back(job);
+}
+
+void AsyncAssetLoader::Start(int workerCount)
+{
+    if (workerCount <= 0)
+        workerCount = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+    workerCount = std::min(workerCount, (int)mJobs.size());
+
+    mReady.reserve(mJobs.size());
+    for (int i = 0; i < workerCount; i++)
+        mWorkers.emplace_back(&AsyncAssetLoader::WorkerMain, this);
+}
+
+void AsyncAssetLoader::WorkerMain()
+{
+    // Jobs are fixed once Start() runs, so workers only need to claim indices.
+    for (int index = mNextJob++; index < (int)mJobs.size(); index = mNextJob++)
+    {
+        Job& job = mJobs[index];
+        if (job.texture != nullptr)
+        {
+            job.ownsData = !mArchive.GetImage(job.fileName.c_str(), &job.image);
+            if (job.ownsData)
+                job.image = LoadImage(job.fileName.c_str());
+        }
+        else
+        {
+            job.ownsData = !mArchive.GetWave(job.fileName.c_str(), &job.wave);
+            if (job.ownsData)
+                job.wave = LoadWave(job.fileName.c_str());
+        }
+
+        std::lock_guard<std::mutex> lock(mReadyMutex);
+        mReady.push_back(index);
+    }
+}
+
+void AsyncAssetLoader::Update(double budgetSeconds)
+{
+    double start = GetTime();
+    do
+    {
+        int index = -1;
+        {
+            std::lock_guard<std::mutex> lock(mReadyMutex);
+            if (mReady.empty())
+                return;
+            index = mReady.back();
+            mReady.pop_back();
+        }
+        Upload(mJobs[index]);
+        mUploaded++;
+    } while (GetTime() - start < budgetSeconds);
+}
+
+void AsyncAssetLoader::Upload(Job& job)
+{
+    if (job.texture != nullptr)
+    {
+        if (IsImageValid(job.image))
+            *job.texture = LoadTextureFromImage(job.image);
+        if (job.ownsData && job.image.data != nullptr)
+            UnloadImage(job.image);
+        job.image = { 0 };
+    }
+    else
+    {
+        if (IsWaveValid(job.wave))
+            *job.sound = LoadSoundFromWave(job.wave);
+        if (job.ownsData && job.wave.data != nullptr)
+            UnloadWave(job.wave);
+        job.wave = { 0 };
+    }
+}
@@ -0,0 +1,207 @@
+#include "coverage.h"
+
+#include <raymath.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define COVERAGE_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr float SAMPLE_STEP = TILE_SIZE / 8.0f;
+    constexpr float RANGE_SQ = TURRET_RANGE * TURRET_RANGE;
+
+    // Padding samples sit far outside any range so they never count.
+    constexpr float FAR_AWAY = 1.0e6f;
+
+    void PadToWidth(std::vector<float>& x, std::vector<float>& y, std::vector<float>& w)
+    {
+        while (x.size() % 4 != 0)
+        {
+            x.push_back(FAR_AWAY);
+            y.push_back(FAR_AWAY);
+            w.push_back(0.0f);
+        }
+    }
+
+    // Sum of w[i] over the samples within TURRET_RANGE of (cx, cy). count must be a multiple of 4.
+    float SumInRange(float cx, float cy, const float* x, const float* y, const float* w, size_t count)
+    {
+#ifdef COVERAGE_SSE2
+        const __m128 vcx = _mm_set1_ps(cx);
+        const __m128 vcy = _mm_set1_ps(cy);
+        const __m128 vr2 = _mm_set1_ps(RANGE_SQ);
+        __m128 sum = _mm_setzero_ps();
+        for (size_t i = 0; i < count; i += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), vcx);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), vcy);
+            __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 inRange = _mm_cmplt_ps(d2, vr2);
+            sum = _mm_add_ps(sum, _mm_and_ps(inRange, _mm_loadu_ps(w + i)));
+        }
+        // Horizontal add of the 4 lanes.
+        __m128 shuf = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1));
+        sum = _mm_add_ps(sum, shuf);
+        shuf = _mm_movehl_ps(shuf, sum);
+        sum = _mm_add_ss(sum, shuf);
+        return _mm_cvtss_f32(sum);
+#else
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            float dx = x[i] - cx;
+            float dy = y[i] - cy;
+            if (dx * dx + dy * dy < RANGE_SQ)
+                sum += w[i];
+        }
+        return sum;
+#endif
+    }
+}
+
+void CoverageMap::Build(const std::vector<Cell>& waypoints, int tiles[TILE_COUNT][TILE_COUNT])
+{
+    mX.clear();
+    mY.clear();
+    mWeight.clear();
+
+    // Sample each path segment at the midpoints of SAMPLE_STEP-long pieces.
+    for (size_t i = 0; i + 1 < waypoints.size(); i++)
+    {
+        Vector2 a = TileCenter(waypoints[i].row, waypoints[i].col);
+        Vector2 b = TileCenter(waypoints[i + 1].row, waypoints[i + 1].col);
+        float length = Vector2Distance(a, b);
+        int pieces = std::max(1, (int)std::ceil(length / SAMPLE_STEP));
+        for (int p = 0; p < pieces; p++)
+        {
+            Vector2 s = Vector2Lerp(a, b, (p + 0.5f) / pieces);
+            mX.push_back(s.x);
+            mY.push_back(s.y);
+            mWeight.push_back(length / pieces);
+        }
+    }
+    mSampleCount = (int)mX.size();
+    PadToWidth(mX, mY, mWeight);
+    mLength = mWeight;
+    mCoverCount.assign(mX.size(), 0);
+
+    for (int row = 0; row < TILE_COUNT; row++)
+        for (int col = 0; col < TILE_COUNT; col++)
+            mGrass[row][col] = tiles[row][col] == GRASS;
+
+    RecomputeAll();
+
+    mMaxHeat = 0.0f;
+    for (float heat : mHeat)
+        mMaxHeat = std::max(mMaxHeat, heat);
+}
+
+void CoverageMap::Reset()
+{
+    for (int i = 0; i < mSampleCount; i++)
+    {
+        if (mCoverCount[i] > 0)
+        {
+            mCoverCount[i] = 0;
+            mWeight[i] = mLength[i];
+        }
+    }
+    RecomputeAll();
+}
+
+void CoverageMap::RecomputeAll()
+{
+    mHeat.assign(TILE_COUNT * TILE_COUNT, 0.0f);
+    for (int row = 0; row < TILE_COUNT; row++)
+    {
+        for (int col = 0; col < TILE_COUNT; col++)
+        {
+            if (!mGrass[row][col])
+                continue;
+            Vector2 center = TileCenter(row, col);
+            mHeat[row * TILE_COUNT + col] = SumInRange(center.x, center.y, mX.data(), mY.data(), mWeight.data(), mX.size());
+        }
+    }
+}
+
+void CoverageMap::AddTurret(Vector2 position)
+{
+    ApplyDelta(position, 1);
+}
+
+void CoverageMap::RemoveTurret(Vector2 position)
+{
+    ApplyDelta(position, -1);
+}
+
+void CoverageMap::ApplyDelta(Vector2 position, int coverDelta)
+{
+    // Collect the samples whose covered/uncovered state flips. Their signed length is the
+    // change to every tile that has them in range.
+    std::vector<float> dx, dy, dw;
+    for (int i = 0; i < mSampleCount; i++)
+    {
+        if (Vector2DistanceSqr({ mX[i], mY[i] }, position) >= RANGE_SQ)
+            continue;
+
+        int before = mCoverCount[i];
+        mCoverCount[i] = std::max(0, before + coverDelta);
+        if (before == 0 && mCoverCount[i] > 0)
+        {
+            dx.push_back(mX[i]);
+            dy.push_back(mY[i]);
+            dw.push_back(-mWeight[i]);
+            mWeight[i] = 0.0f;
+        }
+        else if (before > 0 && mCoverCount[i] == 0)
+        {
+            mWeight[i] = mLength[i];
+            dx.push_back(mX[i]);
+            dy.push_back(mY[i]);
+            dw.push_back(mWeight[i]);
+        }
+    }
+    if (dx.empty())
+        return;
+    PadToWidth(dx, dy, dw);
+
+    // Only tiles within 2 * TURRET_RANGE of the turret can see a flipped sample.
+    int reach = (int)std::ceil(2.0f * TURRET_RANGE / TILE_SIZE);
+    int centerRow = (int)(position.y / TILE_SIZE);
+    int centerCol = (int)(position.x / TILE_SIZE);
+    for (int row = std::max(0, centerRow - reach); row <= std::min(TILE_COUNT - 1, centerRow + reach); row++)
+    {
+        for (int col = std::max(0, centerCol - reach); col <= std::min(TILE_COUNT - 1, centerCol + reach); col++)
+        {
+            if (!mGrass[row][col])
+                continue;
+            Vector2 center = TileCenter(row, col);
+            float& heat = mHeat[row * TILE_COUNT + col];
+            heat = std::max(0.0f, heat + SumInRange(center.x, center.y, dx.data(), dy.data(), dw.data(), dx.size()));
+        }
+    }
+}
+
+void CoverageMap::Draw() const
+{
+    if (mMaxHeat <= 0.0f)
+        return;
+
+    for (int row = 0; row < TILE_COUNT; row++)
+    {
+        for (int col = 0; col < TILE_COUNT; col++)
+        {
+            float heat = mHeat[row * TILE_COUNT + col];
+            if (!mGrass[row][col] || heat <= 0.0f)
+                continue;
+            float t = heat / mMaxHeat;
+            Color color = ColorAlpha(ColorLerp(YELLOW, RED, t), 0.15f + 0.5f * t);
+            DrawRectangle(col * TILE_SIZE, row * TILE_SIZE, TILE_SIZE, TILE_SIZE, color);
+        }
+    }
+}
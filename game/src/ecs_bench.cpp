@@ -0,0 +1,99 @@
+#include "ecs_bench.h"
+#include "game.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    constexpr int BENCH_FRAMES = 20;
+    constexpr float BENCH_DT = 1.0f / 60.0f;
+
+    double Milliseconds(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Shaped like the game's original Bullet, which counted its own lifetime.
+    struct BenchBullet
+    {
+        Vector2 position = Vector2Zeros;
+        Vector2 direction = Vector2Zeros;
+        float time = 0.0f;
+        bool destroy = false;
+    };
+
+    BenchBullet MakeBullet(int i)
+    {
+        BenchBullet bullet;
+        bullet.position = { (float)(i % 800), (float)(i / 800 % 800) };
+        bullet.direction = { 0.6f, 0.8f };
+        // Stagger lifetimes so a few bullets expire every frame.
+        bullet.time = (i % 97) / 97.0f * BULLET_LIFE_TIME;
+        return bullet;
+    }
+
+    // The game's original pattern: update in place, flag, then remove_if + erase, and respawn.
+    double RunVectors(int count)
+    {
+        std::vector<BenchBullet> bullets;
+        for (int i = 0; i < count; i++)
+            bullets.push_back(MakeBullet(i));
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++)
+        {
+            for (BenchBullet& bullet : bullets)
+            {
+                bullet.position += bullet.direction * BULLET_SPEED * BENCH_DT;
+                bullet.time += BENCH_DT;
+                if (bullet.time >= BULLET_LIFE_TIME)
+                    bullet.destroy = true;
+            }
+            size_t before = bullets.size();
+            bullets.erase(std::remove_if(bullets.begin(), bullets.end(), [](const BenchBullet& b) { return b.destroy; }), bullets.end());
+            for (size_t i = bullets.size(); i < before; i++)
+                bullets.push_back(MakeBullet((int)i));
+        }
+        return Milliseconds(start) / BENCH_FRAMES;
+    }
+
+    // Same work through the registry: a typed query, deferred despawns and spawns, one flush.
+    double RunRegistry(int count)
+    {
+        ecs::Registry entities;
+        ecs::CommandBuffer commands;
+        for (int i = 0; i < count; i++)
+            entities.Create(MakeBullet(i));
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++)
+        {
+            int expired = 0;
+            entities.EachEntity<BenchBullet>([&](ecs::Entity entity, BenchBullet& bullet)
+            {
+                bullet.position += bullet.direction * BULLET_SPEED * BENCH_DT;
+                bullet.time += BENCH_DT;
+                if (bullet.time >= BULLET_LIFE_TIME)
+                {
+                    commands.Despawn(entity);
+                    expired++;
+                }
+            });
+            for (int i = 0; i < expired; i++)
+                commands.Spawn(MakeBullet(i));
+            entities.Flush(commands);
+        }
+        return Milliseconds(start) / BENCH_FRAMES;
+    }
+}
+
+int RunEcsBenchmark()
+{
+    printf("%-10s %14s %14s\n", "entities", "vectors ms", "registry ms");
+    for (int count : { 1000, 100000, 1000000 })
+        printf("%-10d %14.3f %14.3f\n", count, RunVectors(count), RunRegistry(count));
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "image_bench.h"
+
+#include <raylib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+namespace
+{
+    constexpr int BENCH_RUNS = 5;
+    constexpr int IMAGE_WIDTH = 3840;
+    constexpr int IMAGE_HEIGHT = 2160;
+
+    // Noise in the color channels plus bands of opaque, transparent and translucent alpha,
+    // so blending sees every case.
+    Image MakeImage(int width, int height)
+    {
+        Image image = GenImageWhiteNoise(width, height, 0.5f);
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        unsigned char* pixels = (unsigned char*)image.data;
+        for (int i = 0; i < width * height; i++)
+        {
+            pixels[i * 4] = (unsigned char)(i * 7);
+            pixels[i * 4 + 1] = (unsigned char)(i / width);
+            int band = i % width / 64 % 4;
+            pixels[i * 4 + 3] = band == 0 ? 255 : band == 1 ? 0 : band == 2 ? 255 : (unsigned char)(i * 13);
+        }
+        return image;
+    }
+
+    // Each run works on a fresh copy, so ops that change the format don't feed into the next run.
+    double Run(const Image& source, const std::function<void(Image&)>& op)
+    {
+        double total = 0.0;
+        for (int run = 0; run < BENCH_RUNS; run++)
+        {
+            Image image = ImageCopy(source);
+            auto start = std::chrono::steady_clock::now();
+            op(image);
+            total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            UnloadImage(image);
+        }
+        return total / BENCH_RUNS;
+    }
+
+    void Print(const char* name, const Image& rgba, const Image& gray, const std::function<void(Image&)>& op)
+    {
+        printf("%-14s %12.3f %12.3f\n", name, Run(rgba, op), Run(gray, op));
+    }
+}
+
+int RunImageBenchmark()
+{
+    Image rgba = MakeImage(IMAGE_WIDTH, IMAGE_HEIGHT);
+    Image gray = ImageCopy(rgba);
+    ImageFormat(&gray, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    Image rgb = ImageCopy(rgba);
+    ImageFormat(&rgb, PIXELFORMAT_UNCOMPRESSED_R8G8B8);
+    Image sprite = MakeImage(1024, 1024);
+    Rectangle spriteRec = { 0, 0, (float)sprite.width, (float)sprite.height };
+
+    printf("%-14s %12s %12s\n", "op", "rgba8 ms", "gray ms");
+    Print("tint", rgba, gray, [](Image& image) { ImageColorTint(&image, { 200, 150, 100, 220 }); });
+    Print("invert", rgba, gray, [](Image& image) { ImageColorInvert(&image); });
+    Print("grayscale", rgba, gray, [](Image& image) { ImageColorGrayscale(&image); });
+    Print("contrast", rgba, gray, [](Image& image) { ImageColorContrast(&image, 40.0f); });
+    Print("brightness", rgba, gray, [](Image& image) { ImageColorBrightness(&image, -60); });
+    Print("replace", rgba, gray, [](Image& image) { ImageColorReplace(&image, { 0, 0, 0, 255 }, RED); });
+    Print("to rgba8", rgb, gray, [](Image& image) { ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8); });
+    Print("to rgb8", rgba, gray, [](Image& image) { ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8); });
+    // Six sprites cover most of the 4K target, half of them tinted.
+    Print("draw blend", rgba, gray, [&](Image& image)
+    {
+        for (int i = 0; i < 6; i++)
+        {
+            Rectangle dstRec = { (float)(i % 3 * 1280), (float)(i / 3 * 1080), spriteRec.width, spriteRec.height };
+            ImageDraw(&image, sprite, spriteRec, dstRec, i % 2 ? WHITE : Color{ 255, 200, 200, 180 });
+        }
+    });
+
+    UnloadImage(sprite);
+    UnloadImage(rgb);
+    UnloadImage(gray);
+    UnloadImage(rgba);
+    return 0;
+}
@@ -1,62 +1,24 @@
 #include <raylib.h>
 #include <raymath.h>
+#include <rlgl.h>
+
+#include "game.h"
+#include "assets.h"
+#include "async_loader.h"
+#include "coverage.h"
+#include "ecs_bench.h"
+#include "image_bench.h"
+#include "self_test.h"
+#include "skinning_bench.h"
+#include "snapshot.h"
+#include "text_run.h"
+#include "timing_wheel.h"
 
 #include <cassert>
 #include <array>
 #include <vector>
 #include <algorithm>
-
-constexpr float SCREEN_SIZE = 800;
-constexpr int TILE_COUNT = 20;
-constexpr float TILE_SIZE = SCREEN_SIZE / TILE_COUNT;
-
-constexpr float BULLET_RADIUS = 10.0f;
-constexpr float BULLET_SPEED = 400.0f;
-constexpr float BULLET_LIFE_TIME = 1.0f;
-constexpr int BULLET_DAMAGE = 25;// ---> damage for each bullet <---
-
-constexpr float TURRET_RADIUS = TILE_SIZE * 0.4f;// ---> added radius for turrets <---
-constexpr float TURRET_RANGE = 200.0f; //---> this defines the ranfe of the turrets <---
-constexpr float TURRET_SHOOT_COOLDOWN = 0.5f; //---> cooldown time for the turrets <---
-constexpr int MAX_TURRETS = 5;                   // ---> added number of maximum turrets <---
-constexpr float ENEMY_RADIUS = TILE_SIZE * 0.5f;// ---> radius for enemy <---
-
-enum TileType : int
-{
-    GRASS,      // Marks unoccupied space, can be overwritten 
-    DIRT,       // Marks the path, cannot be overwritten
-    WAYPOINT,   // Marks where the path turns, cannot be overwritten
-    COUNT
-};
-
-struct Cell
-{
-    int row;
-    int col;
-};
-
-constexpr std::array<Cell, 4> DIRECTIONS{ Cell{ -1, 0 }, Cell{ 1, 0 }, Cell{ 0, -1 }, Cell{ 0, 1 } };
-// --->added enums for different stages for game,for now adding just two phases <--- 
-enum GameState
-{
-	STRATEGY_PHASE,   //--->player will place turrets in this phase<---
-	COMBAT_PHASE,   //--->enemies will move and turrets will shoot in this phase<---
-    LEVEL_WON,
-    LEVEL_LOST
-};
-
-// --->we will define different types of enemy here<---
-enum EnemyType
-{
-    NORMAL, 
-	FAST,       // ---> will move faster than the normal one <---
-	HEAVY,      // ---> will move slowely but have more health <---
-};
-
-inline bool InBounds(Cell cell, int rows = TILE_COUNT, int cols = TILE_COUNT)
-{
-    return cell.col >= 0 && cell.col < cols && cell.row >= 0 && cell.row < rows;
-}
+#include <cstring>
 
 void DrawTile(int row, int col, Color color)
 {
@@ -73,13 +35,6 @@ void DrawTile(int row, int col, int type)
     DrawTile(row, col, colors[type]);
 }
 
-Vector2 TileCenter(int row, int col)
-{
-    float x = col * TILE_SIZE + TILE_SIZE * 0.5f;
-    float y = row * TILE_SIZE + TILE_SIZE * 0.5f;
-    return { x, y };
-}
-
 // Returns a collection of adjacent cells that match the search value.
 std::vector<Cell> FloodFill(Cell start, int tiles[TILE_COUNT][TILE_COUNT], TileType searchValue)
 {
@@ -122,35 +77,12 @@ std::vector<Cell> FloodFill(Cell start, int tiles[TILE_COUNT][TILE_COUNT], TileT
 }
 
 
-struct Bullet
-{
-    Vector2 position = Vector2Zeros;
-    Vector2 direction = Vector2Zeros;
-    float time = 0.0f;
-    bool destroy = false;
-};
-
-// ---> added Turret struct <---
-struct Turret
-{
-    Vector2 position = { 0, 0 };
-    float shootTimer = 0.0f;// ---> added shooting countdown for each turret <---
-};
-// ---> added Enemy struct<---
-struct Enemy
-{
-    EnemyType type;
-    Vector2 position = { 0, 0 };
-    int health = 100;
-    float speed = 100.0f;
-    int waypointIndex = 0;
-    bool shouldBeDestroyed = false;
-};
 Enemy CreateEnemy(EnemyType type, Vector2 startPos, int level)
 {
     Enemy enemy;
     enemy.type = type;
     enemy.position = startPos;
+    enemy.previousPosition = startPos;
     enemy.waypointIndex = 0; //--->to make sure , enemy start from 1st waypoint <---
 	//---> multiplying health and speed to increase the level of difficuilty <---
     float healthMultiplier = 1.0f + (level - 1) * 0.5f; 
@@ -173,8 +105,40 @@ Enemy CreateEnemy(EnemyType type, Vector2 startPos, int level)
     }
     return enemy;
 }
-int main()
+// ---> expected seconds a whole wave spends on each pixel of path, used by the coverage heatmap <---
+float WaveDwellPerPixel(const std::vector<EnemyType>& wave, int level)
 {
+    float dwell = 0.0f;
+    for (EnemyType type : wave)
+        dwell += 1.0f / CreateEnemy(type, Vector2Zeros, level).speed;
+    return dwell;
+}
+int main(int argc, char** argv)
+{
+    // ---> build step: "game --pack-assets" writes assets.pak from the loose files and exits <---
+    if (argc > 1 && strcmp(argv[1], "--pack-assets") == 0)
+    {
+        bool packed = PackAssets(ASSET_ARCHIVE, GAME_ASSET_FILES, sizeof(GAME_ASSET_FILES) / sizeof(GAME_ASSET_FILES[0]));
+        return packed ? 0 : 1;
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-ecs") == 0)
+    {
+        return RunEcsBenchmark();
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-skinning") == 0)
+    {
+        return RunSkinningBenchmark();
+    }
+    if (argc > 1 && strcmp(argv[1], "--bench-images") == 0)
+    {
+        return RunImageBenchmark();
+    }
+    if (argc > 1 && strcmp(argv[1], "--self-test") == 0)
+    {
+        return RunSelfTests();
+    }
+
+
     int tiles[TILE_COUNT][TILE_COUNT]
     {
         //col:0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16 17 18 19    row:
@@ -205,47 +169,311 @@ int main()
     // ---> adding new variable for new levels <---
     std::vector<EnemyType> level2_wave = { FAST, FAST, FAST, HEAVY, HEAVY, NORMAL, NORMAL, FAST, HEAVY, FAST, FAST, HEAVY };
     std::vector<EnemyType> level3_wave = { HEAVY, HEAVY, HEAVY, FAST, FAST, NORMAL, NORMAL, FAST, HEAVY, HEAVY, FAST, NORMAL, HEAVY, FAST, HEAVY };
-    std::vector<EnemyType> current_wave;
+    // ---> all simulation state lives in one World so it can be snapshotted <---
+    World world;
+    std::vector<EnemyType>& current_wave = world.wave;
 
-    int currentLevel = 1;
+    int& currentLevel = world.level;
 
-    // ---> for first enemy <---
-    std::vector<Enemy> enemies;
-    std::vector<Bullet> bullets;
-    std::vector<Turret> turrets;// ---> added for turrets <---
+    // ---> enemies, bullets and turrets are all entities; spawns/despawns during a query go through commands <---
+    ecs::Registry& entities = world.entities;
+    ecs::CommandBuffer commands;
 
     // ---> enemy span <---
-    GameState currentState = STRATEGY_PHASE;
-    int enemiesToSpawn = 0;
-    int enemiesSpawned = 0;
-    float spawnTimer = 0.0f;
-	float spawnInterval = 1.0f; // ---> enemy spawn after second <---
+    GameState& currentState = world.state;
+    int& enemiesToSpawn = world.enemiesToSpawn;
+    int& enemiesSpawned = world.enemiesSpawned;
+	float& spawnInterval = world.spawnInterval; // ---> enemy spawn after second <---
+
+    // ---> coverage heatmap shown while placing turrets, [H] toggles it <---
+    CoverageMap coverage;
+    coverage.Build(waypoints, tiles);
+    bool showCoverage = true;
+    auto resetCoverage = [&]()
+    {
+        const std::vector<EnemyType>& nextWave = currentLevel == 1 ? level1_wave : currentLevel == 2 ? level2_wave : level3_wave;
+        coverage.Reset();
+        coverage.SetDwellPerPixel(WaveDwellPerPixel(nextWave, currentLevel));
+    };
+    resetCoverage();
 
+    // ---> spawns, turret cooldowns and bullet lifetimes are timers; only due ones are touched each frame <---
+    TimingWheel<GameTimer> timers;
+    std::vector<Bullet> firedBullets;
+    auto rebuildTimers = [&]()
+    {
+        timers.Reset(world.tick);
+        if (currentState == COMBAT_PHASE && enemiesSpawned < enemiesToSpawn)
+            timers.Schedule(world.nextSpawnTick, { TIMER_SPAWN, ecs::Entity{} });
+        entities.EachEntity<Turret>([&](ecs::Entity entity, const Turret& turret)
+        {
+            if (!turret.ready)
+                timers.Schedule(turret.readyTick, { TIMER_TURRET_READY, entity });
+        });
+        entities.EachEntity<Bullet>([&](ecs::Entity entity, const Bullet& bullet)
+        {
+            timers.Schedule(bullet.expireTick, { TIMER_BULLET_EXPIRE, entity });
+        });
+    };
+
+    // ---> snapshot taken when a wave starts, for retrying it; quick save on [F5]/[F9] <---
+    Snapshot waveStart;
+    Snapshot quickSave;
+    auto restoreSnapshot = [&](const Snapshot& snapshot)
+    {
+        if (!snapshot.Restore(world))
+            return false;
+        resetCoverage();
+        entities.Each<Turret>([&](const Turret& turret) { coverage.AddTurret(turret.position); });
+        rebuildTimers();
+        return true;
+    };
+
+    // ---> everything is 2D with texcoords in [0,1], so the batch uses the 16-byte interleaved vertex <---
+    rlSetDefaultBatchVertexFormat(RL_BATCH_VERTEX_COMPACT);
     InitWindow(SCREEN_SIZE, SCREEN_SIZE, "Tower Defense");
     InitAudioDevice();
+    // ---> assets come from the packed archive when there is one, loose files otherwise <---
+    AssetArchive assets;
+    assets.Open(ASSET_ARCHIVE);
+    // ---> assets load in the background, sprites show a placeholder and sounds stay silent until uploaded <---
+    Image placeholderImage = GenImageChecked(TILE_SIZE, TILE_SIZE, TILE_SIZE / 4, TILE_SIZE / 4, GRAY, DARKGRAY);
+    Texture2D placeholderTexture = LoadTextureFromImage(placeholderImage);
+    UnloadImage(placeholderImage);
+    AsyncAssetLoader loader(assets);
 	//---> load sounds <---
-    Sound turretCreateSound = LoadSound("create.wav");
-    Sound turretDestroySound = LoadSound("destroy.wav");
-    Sound turretShootSound = LoadSound("shoot.wav");
-    Sound enemyHitSound = LoadSound("hit.wav");
-    Sound enemyDeathSound = LoadSound("death.wav");
+    Sound turretCreateSound = { 0 };
+    Sound turretDestroySound = { 0 };
+    Sound turretShootSound = { 0 };
+    Sound enemyHitSound = { 0 };
+    Sound enemyDeathSound = { 0 };
+    loader.RequestSound("create.wav", &turretCreateSound);
+    loader.RequestSound("destroy.wav", &turretDestroySound);
+    loader.RequestSound("shoot.wav", &turretShootSound);
+    loader.RequestSound("hit.wav", &enemyHitSound);
+    loader.RequestSound("death.wav", &enemyDeathSound);
 	//---> load textures/Sprites <---
-    Texture2D turretTexture = LoadTexture("turret.png");
-    Texture2D bulletTexture = LoadTexture("bullet.png");
-    Texture2D enemyNormalTexture = LoadTexture("enemy_normal.png");
-    Texture2D enemyFastTexture = LoadTexture("enemy_fast.png");
-    Texture2D enemyHeavyTexture = LoadTexture("enemy_heavy.png");
+    Texture2D turretTexture = placeholderTexture;
+    Texture2D bulletTexture = placeholderTexture;
+    Texture2D enemyNormalTexture = placeholderTexture;
+    Texture2D enemyFastTexture = placeholderTexture;
+    Texture2D enemyHeavyTexture = placeholderTexture;
+    loader.RequestTexture("turret.png", &turretTexture);
+    loader.RequestTexture("bullet.png", &bulletTexture);
+    loader.RequestTexture("enemy_normal.png", &enemyNormalTexture);
+    loader.RequestTexture("enemy_fast.png", &enemyFastTexture);
+    loader.RequestTexture("enemy_heavy.png", &enemyHeavyTexture);
+    loader.Start();
+
+    // ---> one fixed combat step; every speed runs exactly these steps, so the outcome doesn't depend on it <---
+    auto stepCombat = [&]()
+    {
+        // ---> FIX: Enemy Spawning logic is now inside COMBAT_PHASE
+        world.tick += SIM_STEP_TICKS;
+        timers.Advance(world.tick, [&](uint64_t due, const GameTimer& timer)
+        {
+            switch (timer.kind)
+            {
+            case TIMER_SPAWN:
+            {
+                Vector2 startPos = TileCenter(waypoints[0].row, waypoints[0].col);
+                EnemyType typeToSpawn = current_wave[enemiesSpawned];
+                entities.Create(CreateEnemy(typeToSpawn, startPos, currentLevel));
+                enemiesSpawned++;
+                // ---> next spawn counts from when this one was due, so no time is lost <---
+                if (enemiesSpawned < enemiesToSpawn)
+                {
+                    world.nextSpawnTick = due + SecondsToTicks(spawnInterval);
+                    timers.Schedule(world.nextSpawnTick, timer);
+                }
+            }
+            break;
+
+            case TIMER_TURRET_READY:
+                if (Turret* turret = entities.Get<Turret>(timer.entity))
+                    turret->ready = true;
+                break;
+
+            case TIMER_BULLET_EXPIRE:
+                if (Bullet* bullet = entities.Get<Bullet>(timer.entity))
+                    bullet->destroy = true;
+                break;
+            }
+        });
+
+        //---> find target to shoot<---
+        entities.EachEntity<Turret>([&](ecs::Entity turretEntity, Turret& turret)
+        {
+            if (turret.ready)//--->when cooldown is over<---
+            {
+
+                // --->find a target<---
+                Enemy* nearestEnemy = nullptr;
+                float minDistance = TURRET_RANGE;
+                
+               
+
+                entities.Each<Enemy>([&](Enemy& enemy)
+                {
+                    float distance = Vector2Distance(turret.position, enemy.position);
+                    
+                    if (distance < minDistance)
+                    {
+                        minDistance = distance; 
+                        nearestEnemy = &enemy;  
+                    }
+                });
+
+                if (nearestEnemy != nullptr)
+                {
+                    turret.ready = false;
+                    turret.readyTick = world.tick + SecondsToTicks(TURRET_SHOOT_COOLDOWN);
+                    timers.Schedule(turret.readyTick, { TIMER_TURRET_READY, turretEntity });
+                    Bullet newBullet;
+                    newBullet.position = turret.position;
+                    newBullet.previousPosition = turret.position;
+                    newBullet.direction = Vector2Normalize(nearestEnemy->position - turret.position);
+                    newBullet.expireTick = world.tick + SecondsToTicks(BULLET_LIFE_TIME);
+                    firedBullets.push_back(newBullet);
+                    PlaySound(turretShootSound);
+                }
+                
+            }
+        });
+        // ---> bullets are created after the turret query, their expiry timers need the new entity <---
+        for (const Bullet& bullet : firedBullets)
+        {
+            timers.Schedule(bullet.expireTick, { TIMER_BULLET_EXPIRE, entities.Create(bullet) });
+        }
+        firedBullets.clear();
+        // 1) Update bullets
+        entities.Each<Bullet>([&](Bullet& bullet)
+        {
+            bullet.previousPosition = bullet.position;
+            bullet.position += bullet.direction * BULLET_SPEED * SIM_DT;
+        });
+        // ---> collision check <---
+        entities.Each<Bullet>([&](Bullet& bullet)
+        {
+            entities.Each<Enemy>([&](Enemy& enemy)
+            {
+                if (CheckCollisionCircles(bullet.position, BULLET_RADIUS, enemy.position, ENEMY_RADIUS))
+                {
+                    bullet.destroy = true;
+                    enemy.health -= BULLET_DAMAGE;
+                    if (enemy.health <= 0)
+                    {
+                        enemy.shouldBeDestroyed = true;
+                        PlaySound(enemyDeathSound);//---> play sound when enemy is destroyed <---
+                    }
+                }
+            });
+        });
+
+        // 2) Remove bullets
+        entities.EachEntity<Bullet>([&](ecs::Entity entity, const Bullet& bullet)
+        {
+            if (bullet.destroy)
+                commands.Despawn(entity);
+        });
+        entities.Flush(commands);
+
+        // Hint: You'll need to add a system (remove_if) that flags enemies for deletion then removes them
+        // Hint: To handle collision, you'll need a nested for-loop that tests all bullets vs all enemies
+
+        
+        // ---> enemy movement <---
+        entities.Each<Enemy>([&](Enemy& enemy)
+        {
+            if (enemy.waypointIndex < waypoints.size() - 1)
+            {
+                Vector2 targetWaypoint = TileCenter(waypoints[enemy.waypointIndex + 1].row, waypoints[enemy.waypointIndex + 1].col);
+                Vector2 direction = Vector2Normalize(targetWaypoint - enemy.position);
+                enemy.previousPosition = enemy.position;
+                enemy.position += direction * enemy.speed * SIM_DT;
+
+                if (Vector2Distance(enemy.position, targetWaypoint) < 5.0f)
+                {
+                    enemy.position = targetWaypoint;
+                    enemy.waypointIndex++;
+                }
+            }
+            else
+            {
+                // --->enemy reached to end and you lost<
+                currentState = LEVEL_LOST;
+            }
+        });
+
+        // ---> erase dead enemies <---
+        entities.EachEntity<Enemy>([&](ecs::Entity entity, const Enemy& e)
+        {
+            if (e.shouldBeDestroyed)
+                commands.Despawn(entity);
+        });
+        entities.Flush(commands);
+
+        if (enemiesSpawned == enemiesToSpawn && entities.Count<Enemy>() == 0)
+        {
+            currentState = LEVEL_WON;
+        }
+    };
+
+    // ---> [1]-[5] pick 1x/2x/4x/16x/max speed; drawing blends the last two steps <---
+    GameSpeed gameSpeed = SPEED_1X;
+    double stepAccumulator = 0.0;
+    // ---> [F3] shows how far frame times stray from the 60 FPS target <---
+    bool showFrameJitter = false;
+
+    // ---> HUD lines keep their glyph quads and only re-layout when their text changes <---
+    TextRun fpsText;
+    TextRun jitterText;
+    TextRun loadingText;
+    TextRun titleText;
+    TextRun hoverText;
+    TextRun hudLines[3];
+    TextRun messageLines[3];
 
     SetTargetFPS(60);
     while (!WindowShouldClose())
     {
         float dt = GetFrameTime();
+        float interpolation = 1.0f;
+
+        for (int speed = 0; speed < SPEED_COUNT; speed++)
+        {
+            if (IsKeyPressed(KEY_ONE + speed))
+                gameSpeed = (GameSpeed)speed;
+        }
+
+        if (IsKeyPressed(KEY_F3))
+        {
+            showFrameJitter = !showFrameJitter;
+        }
+
+        if (!loader.IsDone())
+        {
+            loader.Update(ASSET_UPLOAD_BUDGET);
+        }
+
+        if (IsKeyPressed(KEY_F5))
+        {
+            quickSave.Capture(world);
+            quickSave.SaveToFile("quicksave.bin");
+        }
+        else if (IsKeyPressed(KEY_F9) && quickSave.LoadFromFile("quicksave.bin"))
+        {
+            restoreSnapshot(quickSave);
+        }
         
         switch (currentState)
         {
             case STRATEGY_PHASE:
             { 
-                if (turrets.size() < MAX_TURRETS)         //--->added click left mouse to create turret<---start
+                if (IsKeyPressed(KEY_H))
+                    showCoverage = !showCoverage;
+
+                if (entities.Count<Turret>() < MAX_TURRETS)         //--->added click left mouse to create turret<---start
                 {
                     if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
                     {
@@ -258,7 +486,8 @@ int main()
                         {
                             Turret newTurret;
                             newTurret.position = TileCenter(row, col);
-                            turrets.push_back(newTurret);
+                            entities.Create(newTurret);
+                            coverage.AddTurret(newTurret.position);
 							PlaySound(turretCreateSound);//--->play sound when turret is created<---
                         }
                     }
@@ -266,17 +495,20 @@ int main()
 				if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))//---> added right click to destroy turret <---
                 {
                     Vector2 mousePos = GetMousePosition();
-                    for (int i = 0; i < turrets.size(); ++i)
+                    ecs::Entity clickedTurret;
+                    entities.EachEntity<Turret>([&](ecs::Entity entity, const Turret& turret)
                     {
-                        if (CheckCollisionPointCircle(mousePos, turrets[i].position, TURRET_RADIUS))
-                        {
-                            turrets.erase(turrets.begin() + i);
-                            PlaySound(turretDestroySound); 
-                            break; 
-                        }
+                        if (clickedTurret.index == UINT32_MAX && CheckCollisionPointCircle(mousePos, turret.position, TURRET_RADIUS))
+                            clickedTurret = entity;
+                    });
+                    if (Turret* turret = entities.Get<Turret>(clickedTurret))
+                    {
+                        coverage.RemoveTurret(turret->position);
+                        entities.Destroy(clickedTurret);
+                        PlaySound(turretDestroySound); 
                     }
                 }
-                if (turrets.size() >= MAX_TURRETS)
+                if (entities.Count<Turret>() >= MAX_TURRETS)
                 {
                     currentState = COMBAT_PHASE;
                     if (currentLevel == 1) current_wave = level1_wave;
@@ -284,133 +516,39 @@ int main()
                     else if (currentLevel == 3) current_wave = level3_wave;
                     enemiesToSpawn = current_wave.size();
                     enemiesSpawned = 0;
-                    spawnTimer = 0.0f;
+                    world.nextSpawnTick = world.tick + SecondsToTicks(spawnInterval);
+                    rebuildTimers();
+                    waveStart.Capture(world);
                 }
             } 
             break;
 
             case COMBAT_PHASE:
             { 
-                // ---> FIX: Enemy Spawning logic is now inside COMBAT_PHASE
-                spawnTimer += dt;
-                if (enemiesSpawned < enemiesToSpawn && spawnTimer >= spawnInterval)
-                {
-                    spawnTimer = 0.0f;
-                    Vector2 startPos = TileCenter(waypoints[0].row, waypoints[0].col);
-                    EnemyType typeToSpawn = current_wave[enemiesSpawned];
-                    enemies.push_back(CreateEnemy(typeToSpawn, startPos, currentLevel));
-                    enemiesSpawned++;
-                }
-
-                //---> find target to shoot<---
-                for (auto& turret : turrets)
+                if (gameSpeed == SPEED_MAX)
                 {
-                    turret.shootTimer += dt;//--->this increses the shoot timer<---start
-                    
-                    if (turret.shootTimer >= TURRET_SHOOT_COOLDOWN)//--->when cooldown is over<---
+                    // ---> as many steps as fit in the frame budget, drawn as-is <---
+                    double budgetEnd = GetTime() + SIM_MAX_SPEED_BUDGET;
+                    do
                     {
-
-                        // --->find a target<---
-                        Enemy* nearestEnemy = nullptr;
-                        float minDistance = TURRET_RANGE;
-                        
-                       
-
-                        for (auto& enemy : enemies)
-                        {
-                            float distance = Vector2Distance(turret.position, enemy.position);
-                            
-                            if (distance < minDistance)
-                            {
-                                minDistance = distance; 
-                                nearestEnemy = &enemy;  
-                            }
-                        }
-
-                        if (nearestEnemy != nullptr)
-                        {
-                            turret.shootTimer = 0.0f;
-                            Bullet newBullet;
-                            newBullet.position = turret.position;
-                            newBullet.direction = Vector2Normalize(nearestEnemy->position - turret.position);
-                            bullets.push_back(newBullet);
-                            PlaySound(turretShootSound);
-                        }
-                        
-                    }
+                        stepCombat();
+                    } while (currentState == COMBAT_PHASE && GetTime() < budgetEnd);
+                    stepAccumulator = 0.0;
                 }
-                // 1) Update bullets
-                for (Bullet& bullet : bullets)
-                {
-                    bullet.position += bullet.direction * BULLET_SPEED * dt;
-                    bullet.time += dt;
-
-                    if (bullet.time >= BULLET_LIFE_TIME)
-                    {
-                        bullet.destroy = true;
-                    }
-                }
-                // ---> collision check <---
-                for (auto& bullet : bullets)
-                {
-                    for (auto& enemy : enemies)
-                    {
-                        if (CheckCollisionCircles(bullet.position, BULLET_RADIUS, enemy.position, ENEMY_RADIUS))
-                        {
-                            bullet.destroy = true;
-                            enemy.health -= BULLET_DAMAGE;
-                            if (enemy.health <= 0)
-                            {
-                                enemy.shouldBeDestroyed = true;
-                                PlaySound(enemyDeathSound);//---> play sound when enemy is destroyed <---
-                            }
-                        }
-                    }
-                }
-
-                // 2) Remove bullets
-                auto bulletRemoveStart = std::remove_if(bullets.begin(), bullets.end(),
-                    [](Bullet& bullet)
-                    {
-                        return bullet.destroy;
-                    });
-
-                bullets.erase(bulletRemoveStart, bullets.end());
-
-                // Hint: You'll need to add a system (remove_if) that flags enemies for deletion then removes them
-                // Hint: To handle collision, you'll need a nested for-loop that tests all bullets vs all enemies
-
-                
-                // ---> enemy movement <---
-                for (auto& enemy : enemies)
+                else
                 {
-                    if (enemy.waypointIndex < waypoints.size() - 1)
+                    stepAccumulator += dt * GAME_SPEED_SCALE[gameSpeed];
+                    int steps = 0;
+                    while (stepAccumulator >= SIM_DT && currentState == COMBAT_PHASE && steps < SIM_MAX_STEPS_PER_FRAME)
                     {
-                        Vector2 targetWaypoint = TileCenter(waypoints[enemy.waypointIndex + 1].row, waypoints[enemy.waypointIndex + 1].col);
-                        Vector2 direction = Vector2Normalize(targetWaypoint - enemy.position);
-                        enemy.position += direction * enemy.speed * dt;
-
-                        if (Vector2Distance(enemy.position, targetWaypoint) < 5.0f)
-                        {
-                            enemy.position = targetWaypoint;
-                            enemy.waypointIndex++;
-                        }
+                        stepCombat();
+                        stepAccumulator -= SIM_DT;
+                        steps++;
                     }
+                    if (currentState != COMBAT_PHASE || steps == SIM_MAX_STEPS_PER_FRAME)
+                        stepAccumulator = 0.0;
                     else
-                    {
-                        // --->enemy reached to end and you lost<
-                        currentState = LEVEL_LOST;
-                    }
-                }
-
-                // ---> erase dead enemies <---
-                enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-                    [](const Enemy& e) { return e.shouldBeDestroyed; }),
-                    enemies.end());
-
-                if (enemiesSpawned == enemiesToSpawn && enemies.empty())
-                {
-                    currentState = LEVEL_WON;
+                        interpolation = (float)(stepAccumulator / SIM_DT);
                 }
             }
             break;
@@ -428,9 +566,8 @@ int main()
                     if (IsKeyPressed(KEY_ENTER))
                     {
                         currentLevel++;
-                        turrets.clear();
-                        bullets.clear();
-                        enemies.clear();
+                        entities.Clear();
+                        resetCoverage();
                         currentState = STRATEGY_PHASE;
                     }
                 }
@@ -443,18 +580,20 @@ int main()
                 if (IsKeyPressed(KEY_R)) 
                 {
                     // reset everything 
-                    turrets.clear();
-                    bullets.clear();
-                    enemies.clear();
+                    entities.Clear();
+                    resetCoverage();
                     currentState = STRATEGY_PHASE;
                 }
+                else if (IsKeyPressed(KEY_W) && restoreSnapshot(waveStart))
+                {
+                    // ---> retry the wave with the same turrets <---
+                }
                 else if (IsKeyPressed(KEY_S))
                 {
                     // reset to level 1
                     currentLevel = 1;
-                    turrets.clear();
-                    bullets.clear();
-                    enemies.clear();
+                    entities.Clear();
+                    resetCoverage();
                     currentState = STRATEGY_PHASE;
                 }
             } 
@@ -474,56 +613,104 @@ int main()
                 DrawTile(row, col, tiles[row][col]);
             }
         }
+        if (currentState == STRATEGY_PHASE && showCoverage)
+        {
+            coverage.Draw();
+        }
+        // Sprites are queued and drawn sorted by texture, layers keep turrets under bullets under enemies.
+        rlBeginSpriteQueue();
         // ---> to draw the turrets <---start
-        for (const auto& turret : turrets)
+        rlSetSpriteOrder(0, 0.0f);
+        entities.Each<Turret>([&](const Turret& turret)
         {
             DrawTexture(turretTexture, turret.position.x - TILE_SIZE / 2, turret.position.y - TILE_SIZE / 2, WHITE);
-		}
+		});
 
-        for (const Bullet& bullet : bullets)
+        rlSetSpriteOrder(1, 0.0f);
+        entities.Each<Bullet>([&](const Bullet& bullet)
         {
-            DrawTexture(bulletTexture, bullet.position.x - bulletTexture.width / 2, bullet.position.y - bulletTexture.height / 2, WHITE);
-        }
+            Vector2 position = Vector2Lerp(bullet.previousPosition, bullet.position, interpolation);
+            DrawTexture(bulletTexture, position.x - bulletTexture.width / 2, position.y - bulletTexture.height / 2, WHITE);
+        });
         // ---> enemy drawing logicC <---
-        
-        for (const auto& enemy : enemies)
+        rlSetSpriteOrder(2, 0.0f);
+        entities.Each<Enemy>([&](const Enemy& enemy)
         {
             Texture2D enemyTexture = enemyNormalTexture;
             if (enemy.type == FAST) enemyTexture = enemyFastTexture;
             else if (enemy.type == HEAVY) enemyTexture = enemyHeavyTexture;
 
-            DrawTexture(enemyTexture, enemy.position.x - TILE_SIZE / 2, enemy.position.y - TILE_SIZE / 2, WHITE);
-        }
+            Vector2 position = Vector2Lerp(enemy.previousPosition, enemy.position, interpolation);
+            DrawTexture(enemyTexture, position.x - TILE_SIZE / 2, position.y - TILE_SIZE / 2, WHITE);
+        });
+        rlEndSpriteQueue();
 
         
-        DrawText(TextFormat("%i", GetFPS()), 760, 10, 20, RED);
+        fpsText.Format(760, 10, 20, "%i", GetFPS());
+        fpsText.Draw(RED);
+        if (showFrameJitter)
+        {
+            jitterText.Format(660, 35, 20, "jitter %.3f ms", GetFrameJitter() * 1000.0f);
+            jitterText.Draw(RED);
+        }
+        if (!loader.IsDone())
+        {
+            loadingText.Format(660, 770, 20, "Loading %d%%", (int)(loader.Progress() * 100));
+            loadingText.Draw(WHITE);
+        }
         if (currentState == STRATEGY_PHASE)
 		{//---> added text to show current level and remaining turrets to place <---
-            DrawText(TextFormat("LEVEL %d", currentLevel), 350, 10, 30, WHITE);
-            DrawText(TextFormat("Place %d more turrets.", MAX_TURRETS - turrets.size()), 10, 10, 20, WHITE);
-            DrawText("Left-Click to build.", 10, 40, 20, WHITE);
+            titleText.Format(350, 10, 30, "LEVEL %d", currentLevel);
+            titleText.Draw(WHITE);
+            hudLines[0].Format(10, 10, 20, "Place %d more turrets.", MAX_TURRETS - (int)entities.Count<Turret>());
+            hudLines[1].Set("Left-Click to build.", 10, 40, 20);
+            //---> coverage of the hovered tile <---
+            Vector2 mousePos = GetMousePosition();
+            int hoverRow = mousePos.y / TILE_SIZE;
+            int hoverCol = mousePos.x / TILE_SIZE;
+            if (showCoverage && InBounds({ hoverRow, hoverCol }) && tiles[hoverRow][hoverCol] == GRASS)
+            {
+                hoverText.Format(10, 770, 20, "Covers %.0f px of path, ~%.1f s of enemy time", coverage.PathCovered(hoverRow, hoverCol), coverage.DwellTime(hoverRow, hoverCol));
+                hoverText.Draw(WHITE);
+            }
+            hudLines[2].Set("[H] toggles coverage.", 10, 70, 20);
+            for (const TextRun& line : hudLines)
+                line.Draw(WHITE);
         }
         else if (currentState == LEVEL_WON)
         {
             if (currentLevel == 3)
             {
-                DrawText("YOU WIN! CONGRATULATIONS!", 200, 350, 30, GREEN);
+                messageLines[0].Set("YOU WIN! CONGRATULATIONS!", 200, 350, 30);
+                messageLines[0].Draw(GREEN);
             }
             else
             {
-                DrawText("LEVEL COMPLETE!", 280, 350, 40, GREEN);
-                DrawText("Press [ENTER] for the next level.", 240, 400, 20, WHITE);
+                messageLines[0].Set("LEVEL COMPLETE!", 280, 350, 40);
+                messageLines[0].Draw(GREEN);
+                messageLines[1].Set("Press [ENTER] for the next level.", 240, 400, 20);
+                messageLines[1].Draw(WHITE);
             }
         }
         else if (currentState == LEVEL_LOST)
         {
-            DrawText("LEVEL FAILED!", 300, 350, 40, RED);
-            DrawText("Press [R] to Replay or [S] to Start Over.", 180, 400, 20, WHITE);
+            messageLines[0].Set("LEVEL FAILED!", 300, 350, 40);
+            messageLines[0].Draw(RED);
+            messageLines[1].Set("Press [R] to Replay or [S] to Start Over.", 180, 400, 20);
+            messageLines[1].Draw(WHITE);
+            messageLines[2].Set("Press [W] to retry the wave with the same turrets.", 140, 430, 20);
+            messageLines[2].Draw(WHITE);
         }
         else 
         {
-            DrawText(TextFormat("Level: %d", currentLevel), 10, 10, 20, WHITE);
-            DrawText(TextFormat("Enemies remaining: ~%d", (enemiesToSpawn - enemiesSpawned) + enemies.size()), 10, 40, 20, WHITE);
+            hudLines[0].Format(10, 10, 20, "Level: %d", currentLevel);
+            hudLines[1].Format(10, 40, 20, "Enemies remaining: ~%d", (enemiesToSpawn - enemiesSpawned) + (int)entities.Count<Enemy>());
+            if (gameSpeed == SPEED_MAX)
+                hudLines[2].Set("Speed: max  [1]-[5]", 10, 70, 20);
+            else
+                hudLines[2].Format(10, 70, 20, "Speed: %dx  [1]-[5]", (int)GAME_SPEED_SCALE[gameSpeed]);
+            for (const TextRun& line : hudLines)
+                line.Draw(WHITE);
         }
         EndDrawing();
     }
@@ -533,12 +720,16 @@ int main()
     UnloadSound(turretShootSound);
     UnloadSound(enemyHitSound);
     UnloadSound(enemyDeathSound);
-	// ---> unloading textures <---
-    UnloadTexture(turretTexture);
-    UnloadTexture(bulletTexture);
-    UnloadTexture(enemyNormalTexture);
-    UnloadTexture(enemyFastTexture);
-    UnloadTexture(enemyHeavyTexture);
+	// ---> unloading textures, the ones that never finished loading still share the placeholder <---
+    for (Texture2D texture : { turretTexture, bulletTexture, enemyNormalTexture, enemyFastTexture, enemyHeavyTexture })
+    {
+        if (texture.id != placeholderTexture.id)
+            UnloadTexture(texture);
+    }
+    UnloadTexture(placeholderTexture);
+    // ---> loader workers read from the archive mapping, so they have to be stopped before it's unmapped <---
+    loader.Shutdown();
+    assets.Close();
 
 
     CloseAudioDevice();
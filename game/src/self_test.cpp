@@ -0,0 +1,231 @@
+#include "self_test.h"
+#include "assets.h"
+#include "snapshot.h"
+#include "timing_wheel.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition)
+        {
+            printf("FAILED: %s\n", what);
+            failures++;
+        }
+    }
+
+    // Header fields as uint32 indices, in the order snapshot.cpp writes them.
+    constexpr int HEADER_TOTAL_SIZE = 2;
+    constexpr int HEADER_ENEMY_COUNT = 7;
+
+    void PatchHeader(std::vector<unsigned char>& bytes, int field, uint32_t value)
+    {
+        memcpy(bytes.data() + field * sizeof(uint32_t), &value, sizeof(value));
+    }
+
+    bool LoadBytes(Snapshot& snapshot, std::vector<unsigned char>& bytes)
+    {
+        const char* fileName = "self_test.snapshot";
+        if (!SaveFileData(fileName, bytes.data(), (int)bytes.size()))
+            return false;
+        bool loaded = snapshot.LoadFromFile(fileName);
+        remove(fileName);
+        return loaded;
+    }
+
+    void TestSnapshotFiles()
+    {
+        World world;
+        world.wave = { NORMAL, FAST, HEAVY };
+        for (int i = 0; i < 4; i++)
+            world.entities.Create(Enemy{});
+
+        Snapshot snapshot;
+        snapshot.Capture(world);
+        std::vector<unsigned char> bytes(snapshot.Data(), snapshot.Data() + snapshot.Size());
+
+        Snapshot loaded;
+        std::vector<unsigned char> valid = bytes;
+        Check(LoadBytes(loaded, valid), "snapshot: valid file loads");
+
+        // Cut the last enemy off and fix up totalSize so only the counts give it away.
+        std::vector<unsigned char> truncated(bytes.begin(), bytes.end() - sizeof(Enemy));
+        PatchHeader(truncated, HEADER_TOTAL_SIZE, (uint32_t)truncated.size());
+        Check(!LoadBytes(loaded, truncated), "snapshot: truncated file is rejected");
+        Check(!loaded.IsValid(), "snapshot: rejected file leaves the snapshot empty");
+
+        std::vector<unsigned char> inflated = bytes;
+        PatchHeader(inflated, HEADER_ENEMY_COUNT, 1000000);
+        Check(!LoadBytes(loaded, inflated), "snapshot: inflated enemy count is rejected");
+
+        std::vector<unsigned char> overflowing = bytes;
+        PatchHeader(overflowing, HEADER_ENEMY_COUNT, UINT32_MAX);
+        Check(!LoadBytes(loaded, overflowing), "snapshot: overflowing enemy count is rejected");
+    }
+
+    // Packs one small texture, then points its entry past the end of the file in different ways.
+    void TestAssetArchiveBounds()
+    {
+        const char* imageName = "self_test.png";
+        const char* archiveName = "self_test.pak";
+        Image image = GenImageColor(8, 8, RED);
+        bool exported = ExportImage(image, imageName);
+        UnloadImage(image);
+        bool packed = exported && PackAssets(archiveName, &imageName, 1);
+        remove(imageName);
+        Check(packed, "archive: test archive packs");
+        if (!packed)
+            return;
+
+        int size = 0;
+        unsigned char* data = LoadFileData(archiveName, &size);
+        std::vector<unsigned char> bytes(data, data + size);
+        UnloadFileData(data);
+
+        // The entry table follows the 16-byte header.
+        const size_t entryStart = 4 * sizeof(uint32_t);
+        auto openPatched = [&](size_t field, uint64_t value) {
+            std::vector<unsigned char> patched = bytes;
+            memcpy(patched.data() + entryStart + field, &value, sizeof(value));
+            SaveFileData(archiveName, patched.data(), (int)patched.size());
+            AssetArchive archive;
+            return archive.Open(archiveName);
+        };
+        uint64_t offset = 0;
+        memcpy(&offset, bytes.data() + entryStart + offsetof(AssetArchive::Entry, offset), sizeof(offset));
+
+        Check(openPatched(offsetof(AssetArchive::Entry, offset), offset), "archive: valid archive opens");
+        Check(!openPatched(offsetof(AssetArchive::Entry, offset), (uint64_t)size), "archive: entry past the end is rejected");
+        Check(!openPatched(offsetof(AssetArchive::Entry, size), UINT64_MAX - offset + 1), "archive: entry size wrapping past the end is rejected");
+        Check(!openPatched(offsetof(AssetArchive::Entry, size), 1), "archive: entry smaller than its texture is rejected");
+        remove(archiveName);
+    }
+
+    // Mixed output captured by TestSoundPitchChange(), only while capturing is set.
+    std::atomic<bool> capturing{ false };
+    std::vector<float> capturedLeft;
+    unsigned int captureChannels = 2;
+
+    void CaptureMix(void* buffer, unsigned int frames)
+    {
+        if (!capturing)
+            return;
+        const float* samples = (const float*)buffer;
+        for (unsigned int i = 0; i < frames; i++)
+            capturedLeft.push_back(samples[i * captureChannels]);
+    }
+
+    // A sound played at pitch 1.0 takes the mixer's straight copy path. Moving the pitch to 1.5
+    // mid-playback must not jump in the output, even if an earlier pitched play left other
+    // samples in the resampler. Runs on the real audio device with the master volume at zero.
+    void TestSoundPitchChange()
+    {
+        InitAudioDevice();
+        if (!IsAudioDeviceReady())
+        {
+            printf("audio: no audio device, pitch change check skipped\n");
+            return;
+        }
+        SetMasterVolume(0.0f);
+        // WaitTime() needs the window's timer, these checks run without one.
+
+        // A slow ramp keeps consecutive samples within 0.0001 of each other at pitch 1.5, while
+        // the pitched play leaves the resampler far ahead of where the switch happens.
+        const int frameCount = 48000 * 2;
+        std::vector<float> samples(frameCount * 2);
+        for (int i = 0; i < frameCount; i++)
+            samples[i * 2] = samples[i * 2 + 1] = 0.5f * i / frameCount;
+        Wave wave = { (unsigned int)frameCount, 48000, 32, 2, samples.data() };
+        Sound sound = LoadSoundFromWave(wave);
+
+        // The resampler may drop its history on its own depending on where the switch lands,
+        // a few rounds at different offsets make a stale one show up reliably.
+        bool captured = true;
+        float largestStep = 0.0f;
+        for (int round = 0; round < 3; round++)
+        {
+            SetSoundPitch(sound, 1.5f);
+            PlaySound(sound);
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+            StopSound(sound);
+
+            captureChannels = 2;
+            capturedLeft.clear();
+            capturedLeft.reserve(48000);
+            AttachAudioMixedProcessor(CaptureMix);
+            SetSoundPitch(sound, 1.0f);
+            PlaySound(sound);
+            capturing = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(80 + round * 7));
+            SetSoundPitch(sound, 1.5f);
+            std::this_thread::sleep_for(std::chrono::milliseconds(60));
+            capturing = false;
+            DetachAudioMixedProcessor(CaptureMix);
+            StopSound(sound);
+
+            captured = captured && !capturedLeft.empty();
+            for (size_t i = 1; i < capturedLeft.size(); i++)
+                largestStep = fmaxf(largestStep, fabsf(capturedLeft[i] - capturedLeft[i - 1]));
+        }
+        Check(captured, "audio: mixer output was captured");
+        Check(largestStep < 0.001f, "audio: pitch change during playback has no discontinuity");
+
+        UnloadSound(sound);
+        CloseAudioDevice();
+    }
+
+    void TestTimingWheel()
+    {
+        // The first tick of each level boundary, plus neighbours on either side.
+        const uint64_t dues[] = { 1, 255, 256, 257, 511, 512, 513, 16383, 16384, 16385, 1048576 };
+        TimingWheel<uint64_t> wheel;
+        for (uint64_t due : dues)
+            wheel.Schedule(due, due);
+
+        int fired = 0;
+        bool onTime = true;
+        wheel.Advance(1048576 + 10, [&](uint64_t due, uint64_t payload) {
+            fired++;
+            if (due != payload || wheel.Now() != due)
+            {
+                printf("timing wheel: timer due at %llu fired at %llu\n", (unsigned long long)payload, (unsigned long long)wheel.Now());
+                onTime = false;
+            }
+        });
+        Check(fired == (int)(sizeof(dues) / sizeof(dues[0])), "timing wheel: every timer fires");
+        Check(onTime, "timing wheel: timers fire on their due tick across level boundaries");
+
+        // Timers scheduled mid-run cascade relative to the current clock, not tick zero.
+        wheel.Reset(100);
+        wheel.Schedule(100 + 256, 256);
+        wheel.Schedule(100 + 16384, 16384);
+        onTime = true;
+        wheel.Advance(100 + 20000, [&](uint64_t due, uint64_t) {
+            if (wheel.Now() != due)
+                onTime = false;
+        });
+        Check(onTime, "timing wheel: timers scheduled after tick zero fire on their due tick");
+    }
+}
+
+int RunSelfTests()
+{
+    SetTraceLogLevel(LOG_WARNING);
+    TestSnapshotFiles();
+    TestAssetArchiveBounds();
+    TestTimingWheel();
+    TestSoundPitchChange();
+    printf("%s (%d failed)\n", failures == 0 ? "all checks passed" : "self test failed", failures);
+    return failures;
+}
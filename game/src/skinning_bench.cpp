@@ -0,0 +1,140 @@
+#include "skinning_bench.h"
+
+#include <raylib.h>
+#include <raymath.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr int BENCH_FRAMES = 10;
+    constexpr int BONE_COUNT = 64;
+
+    double Milliseconds(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Owns the arrays a skinned Mesh points into. vboId stays null, so nothing is uploaded.
+    struct BenchModel
+    {
+        std::vector<float> vertices, normals, animVertices, animNormals, boneWeights;
+        std::vector<unsigned char> boneIds;
+        std::vector<Matrix> boneMatrices;
+        std::vector<BoneInfo> bones;
+        std::vector<Transform> bindPose, framePose;
+        Transform* framePoses[1] = {};
+        Mesh mesh = {};
+        Model model = {};
+        ModelAnimation anim = {};
+
+        explicit BenchModel(int vertexCount)
+        {
+            vertices.resize(vertexCount * 3);
+            normals.resize(vertexCount * 3);
+            animVertices.resize(vertexCount * 3);
+            animNormals.resize(vertexCount * 3);
+            boneWeights.resize(vertexCount * 4);
+            boneIds.resize(vertexCount * 4);
+            for (int v = 0; v < vertexCount; v++)
+            {
+                vertices[v * 3] = (float)(v % 100);
+                vertices[v * 3 + 1] = (float)(v / 100 % 100);
+                vertices[v * 3 + 2] = (float)(v / 10000);
+                normals[v * 3 + 1] = 1.0f;
+                // Most vertices follow two bones, every fourth one is weighted across all four.
+                int influences = (v % 4 == 0) ? 4 : 2;
+                for (int j = 0; j < influences; j++)
+                {
+                    boneIds[v * 4 + j] = (unsigned char)((v + j * 7) % BONE_COUNT);
+                    boneWeights[v * 4 + j] = 1.0f / influences;
+                }
+            }
+
+            boneMatrices.resize(BONE_COUNT, MatrixIdentity());
+            bones.resize(BONE_COUNT);
+            bindPose.resize(BONE_COUNT);
+            framePose.resize(BONE_COUNT);
+            for (int b = 0; b < BONE_COUNT; b++)
+            {
+                bones[b].parent = b - 1;
+                bindPose[b] = { { 0.0f, (float)b, 0.0f }, QuaternionIdentity(), Vector3One() };
+                framePose[b] = { { 0.1f * b, (float)b, 0.0f }, QuaternionFromAxisAngle({ 0.0f, 1.0f, 0.0f }, 0.05f * b), Vector3One() };
+            }
+            framePoses[0] = framePose.data();
+
+            mesh.vertexCount = vertexCount;
+            mesh.vertices = vertices.data();
+            mesh.normals = normals.data();
+            mesh.animVertices = animVertices.data();
+            mesh.animNormals = animNormals.data();
+            mesh.boneIds = boneIds.data();
+            mesh.boneWeights = boneWeights.data();
+            mesh.boneMatrices = boneMatrices.data();
+            mesh.boneCount = BONE_COUNT;
+
+            model.meshCount = 1;
+            model.meshes = &mesh;
+            model.boneCount = BONE_COUNT;
+            model.bones = bones.data();
+            model.bindPose = bindPose.data();
+
+            anim.boneCount = BONE_COUNT;
+            anim.frameCount = 1;
+            anim.bones = bones.data();
+            anim.framePoses = framePoses;
+        }
+    };
+
+    // raylib 5.5's loop: every influence transforms the vertex and the normal separately.
+    double RunScalar(BenchModel& bench)
+    {
+        Mesh& mesh = bench.mesh;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++)
+        {
+            UpdateModelAnimationBones(bench.model, bench.anim, 0);
+            for (int v = 0; v < mesh.vertexCount * 3; v += 3)
+            {
+                Vector3 position = Vector3Zeros;
+                Vector3 normal = Vector3Zeros;
+                for (int j = 0; j < 4; j++)
+                {
+                    float weight = mesh.boneWeights[v / 3 * 4 + j];
+                    if (weight == 0.0f)
+                        continue;
+                    const Matrix& bone = mesh.boneMatrices[mesh.boneIds[v / 3 * 4 + j]];
+                    position += Vector3Transform({ mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2] }, bone) * weight;
+                    normal += Vector3Transform({ mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2] }, bone) * weight;
+                }
+                memcpy(&mesh.animVertices[v], &position, sizeof(position));
+                memcpy(&mesh.animNormals[v], &normal, sizeof(normal));
+            }
+        }
+        return Milliseconds(start) / BENCH_FRAMES;
+    }
+
+    double RunRaylib(BenchModel& bench, bool normals)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++)
+            UpdateModelAnimationEx(bench.model, bench.anim, 0, normals);
+        return Milliseconds(start) / BENCH_FRAMES;
+    }
+}
+
+int RunSkinningBenchmark()
+{
+    printf("%-10s %14s %14s %14s\n", "vertices", "scalar ms", "skinned ms", "no normals ms");
+    for (int count : { 10000, 100000, 1000000 })
+    {
+        BenchModel bench(count);
+        double scalar = RunScalar(bench);
+        double skinned = RunRaylib(bench, true);
+        printf("%-10d %14.3f %14.3f %14.3f\n", count, scalar, skinned, RunRaylib(bench, false));
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+#include "snapshot.h"
+
+#include <cstring>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<Enemy>::value, "Enemy is copied as raw bytes");
+static_assert(std::is_trivially_copyable<Bullet>::value, "Bullet is copied as raw bytes");
+static_assert(std::is_trivially_copyable<Turret>::value, "Turret is copied as raw bytes");
+
+namespace
+{
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t totalSize;
+        // Element sizes guard against loading a file written by a build with different structs.
+        uint32_t enemySize;
+        uint32_t bulletSize;
+        uint32_t turretSize;
+        uint32_t waveCount;
+        uint32_t enemyCount;
+        uint32_t bulletCount;
+        uint32_t turretCount;
+    };
+
+    struct Scalars
+    {
+        int32_t state;
+        int32_t level;
+        int32_t enemiesToSpawn;
+        int32_t enemiesSpawned;
+        float spawnInterval;
+        uint64_t tick;
+        uint64_t nextSpawnTick;
+    };
+
+    template <typename T>
+    unsigned char* WriteArray(unsigned char* out, const std::vector<T>& items)
+    {
+        size_t bytes = items.size() * sizeof(T);
+        if (bytes > 0)
+            memcpy(out, items.data(), bytes);
+        return out + bytes;
+    }
+
+    // Entity kinds are single-component archetypes, so their rows go out chunk by chunk.
+    template <typename T>
+    unsigned char* WriteComponents(unsigned char* out, ecs::Registry& entities)
+    {
+        entities.EachChunk<T>([&](size_t count, ecs::Entity*, T* components)
+        {
+            memcpy(out, components, count * sizeof(T));
+            out += count * sizeof(T);
+        });
+        return out;
+    }
+
+    template <typename T>
+    const unsigned char* ReadComponents(const unsigned char* in, ecs::Registry& entities, uint32_t count)
+    {
+        entities.CreateMany((const T*)in, count);
+        return in + count * sizeof(T);
+    }
+
+    // Adds count elements of elementSize bytes to total, false if the sum would overflow.
+    bool AddArraySize(uint64_t& total, uint32_t count, size_t elementSize)
+    {
+        if (elementSize != 0 && count > (UINT64_MAX - total) / elementSize)
+            return false;
+        total += (uint64_t)count * elementSize;
+        return true;
+    }
+
+    template <typename T>
+    const unsigned char* ReadArray(const unsigned char* in, std::vector<T>& items, uint32_t count)
+    {
+        // resize() keeps the existing capacity, so restoring into a live world doesn't allocate.
+        items.resize(count);
+        size_t bytes = count * sizeof(T);
+        if (bytes > 0)
+            memcpy(items.data(), in, bytes);
+        return in + bytes;
+    }
+}
+
+Snapshot::Snapshot(size_t entityCapacity)
+{
+    mBuffer.resize(sizeof(Header) + sizeof(Scalars) +
+        entityCapacity * (sizeof(EnemyType) + sizeof(Enemy) + sizeof(Bullet) + sizeof(Turret)));
+}
+
+void Snapshot::Capture(World& world)
+{
+    Header header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.enemySize = sizeof(Enemy);
+    header.bulletSize = sizeof(Bullet);
+    header.turretSize = sizeof(Turret);
+    header.waveCount = (uint32_t)world.wave.size();
+    header.enemyCount = (uint32_t)world.entities.Count<Enemy>();
+    header.bulletCount = (uint32_t)world.entities.Count<Bullet>();
+    header.turretCount = (uint32_t)world.entities.Count<Turret>();
+
+    size_t size = sizeof(Header) + sizeof(Scalars) +
+        world.wave.size() * sizeof(EnemyType) +
+        header.enemyCount * sizeof(Enemy) +
+        header.bulletCount * sizeof(Bullet) +
+        header.turretCount * sizeof(Turret);
+    header.totalSize = (uint32_t)size;
+    if (size > mBuffer.size())
+        mBuffer.resize(size);
+
+    Scalars scalars;
+    scalars.state = world.state;
+    scalars.level = world.level;
+    scalars.enemiesToSpawn = world.enemiesToSpawn;
+    scalars.enemiesSpawned = world.enemiesSpawned;
+    scalars.spawnInterval = world.spawnInterval;
+    scalars.tick = world.tick;
+    scalars.nextSpawnTick = world.nextSpawnTick;
+
+    unsigned char* out = mBuffer.data();
+    memcpy(out, &header, sizeof(Header));
+    out += sizeof(Header);
+    memcpy(out, &scalars, sizeof(Scalars));
+    out += sizeof(Scalars);
+    out = WriteArray(out, world.wave);
+    out = WriteComponents<Enemy>(out, world.entities);
+    out = WriteComponents<Bullet>(out, world.entities);
+    out = WriteComponents<Turret>(out, world.entities);
+    mSize = size;
+}
+
+bool Snapshot::IsValid() const
+{
+    if (mSize < sizeof(Header) + sizeof(Scalars))
+        return false;
+
+    Header header;
+    memcpy(&header, mBuffer.data(), sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION || header.totalSize != mSize ||
+        header.enemySize != sizeof(Enemy) || header.bulletSize != sizeof(Bullet) || header.turretSize != sizeof(Turret))
+        return false;
+
+    // The counts decide how much Restore() copies, so they have to add up to exactly the bytes we hold.
+    uint64_t size = sizeof(Header) + sizeof(Scalars);
+    return AddArraySize(size, header.waveCount, sizeof(EnemyType)) &&
+        AddArraySize(size, header.enemyCount, sizeof(Enemy)) &&
+        AddArraySize(size, header.bulletCount, sizeof(Bullet)) &&
+        AddArraySize(size, header.turretCount, sizeof(Turret)) &&
+        size == header.totalSize;
+}
+
+bool Snapshot::Restore(World& world) const
+{
+    if (!IsValid())
+        return false;
+
+    Header header;
+    Scalars scalars;
+    const unsigned char* in = mBuffer.data();
+    memcpy(&header, in, sizeof(Header));
+    in += sizeof(Header);
+    memcpy(&scalars, in, sizeof(Scalars));
+    in += sizeof(Scalars);
+
+    world.state = (GameState)scalars.state;
+    world.level = scalars.level;
+    world.enemiesToSpawn = scalars.enemiesToSpawn;
+    world.enemiesSpawned = scalars.enemiesSpawned;
+    world.spawnInterval = scalars.spawnInterval;
+    world.tick = scalars.tick;
+    world.nextSpawnTick = scalars.nextSpawnTick;
+    in = ReadArray(in, world.wave, header.waveCount);
+    // Clear() keeps the registry's chunks, so restoring into a live world doesn't allocate.
+    world.entities.Clear();
+    in = ReadComponents<Enemy>(in, world.entities, header.enemyCount);
+    in = ReadComponents<Bullet>(in, world.entities, header.bulletCount);
+    in = ReadComponents<Turret>(in, world.entities, header.turretCount);
+    return true;
+}
+
+bool Snapshot::SaveToFile(const char* fileName) const
+{
+    if (!IsValid())
+        return false;
+    return SaveFileData(fileName, (void*)mBuffer.data(), (int)mSize);
+}
+
+bool Snapshot::LoadFromFile(const char* fileName)
+{
+    int dataSize = 0;
+    unsigned char* data = LoadFileData(fileName, &dataSize);
+    if (data == nullptr)
+        return false;
+
+    if ((size_t)dataSize > mBuffer.size())
+        mBuffer.resize(dataSize);
+    memcpy(mBuffer.data(), data, dataSize);
+    mSize = dataSize;
+    UnloadFileData(data);
+
+    if (!IsValid())
+    {
+        mSize = 0;
+        return false;
+    }
+    return true;
+}
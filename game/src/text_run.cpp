@@ -0,0 +1,138 @@
+#include "text_run.h"
+
+#include <rlgl.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    // raylib's default between-line gap (SetTextLineSpacing), HUD runs are single line anyway.
+    constexpr float LINE_SPACING = 2.0f;
+    constexpr int DEFAULT_FONT_SIZE = 10;
+}
+
+int FormatText(char* buffer, int size, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, size, format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        buffer[0] = '\0';
+        return 0;
+    }
+    return length < size ? length : size - 1;
+}
+
+void TextRun::Set(const char* text, int posX, int posY, int fontSize)
+{
+    if (fontSize < DEFAULT_FONT_SIZE)
+        fontSize = DEFAULT_FONT_SIZE;
+    Set(GetFontDefault(), text, { (float)posX, (float)posY }, (float)fontSize, (float)(fontSize / DEFAULT_FONT_SIZE));
+}
+
+void TextRun::Set(Font font, const char* text, Vector2 position, float fontSize, float spacing)
+{
+    if (font.texture.id == 0)
+        font = GetFontDefault();
+
+    if (mBuilt && mText == text && mFont.texture.id == font.texture.id && mFont.glyphs == font.glyphs &&
+        mPosition.x == position.x && mPosition.y == position.y && mFontSize == fontSize && mSpacing == spacing)
+        return;
+
+    // assign() reuses the string's capacity, so values of similar length don't allocate.
+    mText.assign(text);
+    mFont = font;
+    mPosition = position;
+    mFontSize = fontSize;
+    mSpacing = spacing;
+    Rebuild();
+}
+
+void TextRun::Format(int posX, int posY, int fontSize, const char* format, ...)
+{
+    char buffer[TEXT_RUN_MAX_LENGTH];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0)
+        buffer[0] = '\0';
+
+    Set(buffer, posX, posY, fontSize);
+}
+
+// Same layout as DrawTextEx() + DrawTextCodepoint(), written out as quad corners in
+// DrawTexturePro() order: top-left, bottom-left, bottom-right, top-right.
+void TextRun::Rebuild()
+{
+    mBuilt = true;
+    mVertices.clear();
+    mTexcoords.clear();
+    if (mFont.texture.id == 0)
+        return;
+
+    float scale = mFontSize / mFont.baseSize;
+    float padding = (float)mFont.glyphPadding;
+    float width = (float)mFont.texture.width;
+    float height = (float)mFont.texture.height;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+
+    const char* text = mText.c_str();
+    int size = (int)mText.size();
+    for (int i = 0; i < size;)
+    {
+        int byteCount = 0;
+        int codepoint = GetCodepointNext(&text[i], &byteCount);
+        int index = GetGlyphIndex(mFont, codepoint);
+        i += byteCount;
+
+        if (codepoint == '\n')
+        {
+            offsetY += mFontSize + LINE_SPACING;
+            offsetX = 0.0f;
+            continue;
+        }
+
+        const GlyphInfo& glyph = mFont.glyphs[index];
+        const Rectangle& rec = mFont.recs[index];
+        if (codepoint != ' ' && codepoint != '\t')
+        {
+            float x0 = mPosition.x + offsetX + (glyph.offsetX - padding) * scale;
+            float y0 = mPosition.y + offsetY + (glyph.offsetY - padding) * scale;
+            float x1 = x0 + (rec.width + 2.0f * padding) * scale;
+            float y1 = y0 + (rec.height + 2.0f * padding) * scale;
+            float u0 = (rec.x - padding) / width;
+            float v0 = (rec.y - padding) / height;
+            float u1 = (rec.x + rec.width + padding) / width;
+            float v1 = (rec.y + rec.height + padding) / height;
+
+            mVertices.insert(mVertices.end(), { x0, y0, x0, y1, x1, y1, x1, y0 });
+            mTexcoords.insert(mTexcoords.end(), { u0, v0, u0, v1, u1, v1, u1, v0 });
+        }
+
+        if (glyph.advanceX == 0)
+            offsetX += rec.width * scale + mSpacing;
+        else
+            offsetX += glyph.advanceX * scale + mSpacing;
+    }
+}
+
+void TextRun::Draw(Color tint) const
+{
+    if (mVertices.empty())
+        return;
+
+    rlSetTexture(mFont.texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    rlVertexQuads2f(mVertices.data(), mTexcoords.data(), (int)(mVertices.size() / 8));
+    rlEnd();
+    rlSetTexture(0);
+}
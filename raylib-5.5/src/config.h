@@ -57,7 +57,13 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
-#define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
+//#define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
+// Use a deadline wait loop, frames are paced against absolute deadlines and the sleep wakes up early only
+// by the measured wake-up latency, so the final busy loop is a few hundred microseconds at most
+#define SUPPORT_DEADLINE_WAIT_LOOP       1
+// Use adaptive V-Sync when FLAG_VSYNC_HINT is set and the driver supports it: late frames are presented
+// immediately (may tear) instead of waiting for the next vertical blank
+//#define SUPPORT_ADAPTIVE_VSYNC           1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
@@ -104,7 +110,7 @@
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
-#define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_BUFFERS               3      // Default number of batch buffers (multi-buffering), persistent mapped on OpenGL 4.4 if more than 1
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 
@@ -186,6 +192,16 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Split GenImagePerlinNoise() and GenImageCellular() into row tiles processed on worker threads
+#define SUPPORT_IMAGE_GENERATION_THREADS    1
+// Decode files on worker threads in LoadImages()
+#define SUPPORT_IMAGE_LOADING_THREADS       1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define IMAGE_GENERATION_MAX_THREADS    8       // Maximum threads used to generate one image
+#define IMAGE_GENERATION_TILE_ROWS     64       // Image rows per generation tile
+#define IMAGE_LOADING_MAX_THREADS       8       // Maximum threads used to decode a batch of images
 
 
 //------------------------------------------------------------------------------------
@@ -228,10 +244,17 @@
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Split CPU skinning of large meshes across worker threads in UpdateModelAnimation()
+#define SUPPORT_MESH_SKINNING_THREADS   1
+// Build a BVH per mesh on first GetRayCollisionMesh() query, for meshes above MESH_BVH_MIN_TRIANGLES
+#define SUPPORT_MESH_BVH                1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define MESH_SKINNING_MAX_THREADS       8       // Maximum threads used to skin one mesh on CPU
+#define MESH_SKINNING_THREAD_VERTICES   32768   // Minimum vertices skinned per thread
+#define MESH_BVH_MIN_TRIANGLES         64       // Minimum mesh triangles to build a BVH for ray queries
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -251,6 +274,10 @@
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
 
+// Decode music streams on a dedicated thread into a ring buffer read by the mixer,
+// playback does not depend on UpdateMusicStream() being called every frame
+#define SUPPORT_MUSIC_DECODE_THREAD     1
+
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
@@ -258,6 +285,8 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define SOUND_RESAMPLE_LPF_ORDER           4    // Sound load resampling low-pass filter order (0 to 8, higher is better quality)
+#define MUSIC_DECODE_LATENCY_MS          200    // Music decode thread ring buffer length in milliseconds
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
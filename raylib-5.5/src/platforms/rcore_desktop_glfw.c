@@ -106,6 +106,8 @@ static PlatformData platform = { 0 };   // Platform specific data
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);        // Close platform
 
+static int GetVsyncSwapInterval(void);                                                      // Get swap interval for V-Sync, -1 if adaptive V-Sync is enabled and supported
+
 // Error callback event
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
 
@@ -191,7 +193,7 @@ void ToggleFullscreen(void)
 
     // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
     // NOTE: V-Sync can be enabled by graphic driver configuration
-    if (CORE.Window.flags & FLAG_VSYNC_HINT) glfwSwapInterval(1);
+    if (CORE.Window.flags & FLAG_VSYNC_HINT) glfwSwapInterval(GetVsyncSwapInterval());
 }
 
 // Toggle borderless windowed mode
@@ -310,7 +312,7 @@ void SetWindowState(unsigned int flags)
     // State change: FLAG_VSYNC_HINT
     if (((CORE.Window.flags & FLAG_VSYNC_HINT) != (flags & FLAG_VSYNC_HINT)) && ((flags & FLAG_VSYNC_HINT) > 0))
     {
-        glfwSwapInterval(1);
+        glfwSwapInterval(GetVsyncSwapInterval());
         CORE.Window.flags |= FLAG_VSYNC_HINT;
     }
 
@@ -1557,7 +1559,7 @@ int InitPlatform(void)
         if (CORE.Window.flags & FLAG_VSYNC_HINT)
         {
             // WARNING: It seems to hit a critical render path in Intel HD Graphics
-            glfwSwapInterval(1);
+            glfwSwapInterval(GetVsyncSwapInterval());
             TRACELOG(LOG_INFO, "DISPLAY: Trying to enable VSYNC");
         }
 
@@ -1701,6 +1703,17 @@ void ClosePlatform(void)
 #endif
 }
 
+// Get swap interval for V-Sync
+// NOTE: Adaptive V-Sync (negative interval) presents a late frame immediately instead of
+// waiting for the next vertical blank, it requires a context current on the calling thread
+static int GetVsyncSwapInterval(void)
+{
+#if defined(SUPPORT_ADAPTIVE_VSYNC)
+    if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear")) return -1;
+#endif
+    return 1;
+}
+
 // GLFW3 Error Callback, runs on GLFW3 error
 static void ErrorCallback(int error, const char *description)
 {
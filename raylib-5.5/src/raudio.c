@@ -299,6 +299,15 @@ typedef struct tagBITMAPINFOHEADER {
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
 
+#ifndef SOUND_RESAMPLE_LPF_ORDER
+    #define SOUND_RESAMPLE_LPF_ORDER           4    // Sound load resampling low-pass filter order (0 to 8)
+#endif
+#define AUDIO_BUFFER_PRIME_FRAMES             32    // Frames fed to a converter that resumes after the straight copy path
+
+#ifndef MUSIC_DECODE_LATENCY_MS
+    #define MUSIC_DECODE_LATENCY_MS          200    // Music decode thread ring buffer length in milliseconds
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -338,6 +347,19 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Music decoder struct
+// NOTE: Music streams are decoded ahead by the decode thread into a ring buffer,
+// single producer (decode thread) and single consumer (mixer), so reads and writes are lock-free
+typedef struct MusicDecoder {
+    Music music;                    // Music stream copy used for decoding (looping updated on play/update)
+    ma_pcm_rb ring;                 // Decoded frames ring buffer, in stream format
+    unsigned int framesDecoded;     // Frames decoded from the start of the music
+    bool ended;                     // All frames decoded (no looping), mixer stops the stream when drained
+    struct MusicDecoder *next;      // Next music decoder on the list
+} MusicDecoder;
+#endif
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -353,6 +375,7 @@ struct rAudioBuffer {
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
+    bool isPassthrough;             // Audio buffer data in mixing format (device format, channels and sample rate)
 
     bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
     unsigned int sizeInFrames;      // Total buffer size in frames
@@ -360,6 +383,9 @@ struct rAudioBuffer {
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    MusicDecoder *decoder;          // Music decoder, replaces data buffer on music streams if available
+#endif
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -390,6 +416,14 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    struct {
+        ma_thread thread;           // Music decode thread
+        ma_mutex lock;              // Music decoders list and decoder contexts lock
+        ma_atomic_bool32 running;   // Music decode thread running
+        MusicDecoder *first;        // Pointer to first MusicDecoder in the list
+    } Music;
+#endif
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -414,6 +448,7 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 // Reads audio data from an AudioBuffer object in internal/device formats
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static void PrimeAudioBufferConverter(AudioBuffer *audioBuffer);  // Reset converter and feed it the frames played before the cursor
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
@@ -422,6 +457,18 @@ static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+static void DecodeMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount); // Decode music stream frames, rewinding at the end of data
+static void RewindMusicStream(Music music);                                              // Seek music stream decoder to start
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+static void LoadMusicDecoder(Music music);                                      // Create music decoder and add it to the decode thread list
+static void UnloadMusicDecoder(MusicDecoder *decoder);                          // Remove music decoder from the decode thread list and free it
+static void FillMusicDecoder(MusicDecoder *decoder);                            // Decode music frames into decoder ring buffer until full
+static void ResetMusicDecoder(MusicDecoder *decoder, unsigned int position);    // Drop decoded frames and restart decoding from position
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount); // Read decoded frames from ring buffer (mixer)
+static ma_thread_result MA_THREADCALL MusicDecodeThread(void *data);            // Music decode thread, keeps ring buffers filled
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -518,6 +565,22 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music streams are decoded ahead on their own thread, playback does not depend on UpdateMusicStream() calls
+    if (ma_mutex_init(&AUDIO.Music.lock) == MA_SUCCESS)
+    {
+        ma_atomic_bool32_set(&AUDIO.Music.running, MA_TRUE);
+
+        if (ma_thread_create(&AUDIO.Music.thread, ma_thread_priority_normal, 0, MusicDecodeThread, NULL, NULL) != MA_SUCCESS)
+        {
+            ma_atomic_bool32_set(&AUDIO.Music.running, MA_FALSE);
+            ma_mutex_uninit(&AUDIO.Music.lock);
+        }
+    }
+
+    if (!ma_atomic_bool32_get(&AUDIO.Music.running)) TRACELOG(LOG_WARNING, "AUDIO: Failed to create music decode thread, music requires UpdateMusicStream()");
+#endif
+
     AUDIO.System.isReady = true;
 }
 
@@ -526,6 +589,15 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        if (ma_atomic_bool32_get(&AUDIO.Music.running))
+        {
+            ma_atomic_bool32_set(&AUDIO.Music.running, MA_FALSE);
+            ma_thread_wait(&AUDIO.Music.thread);
+            ma_mutex_uninit(&AUDIO.Music.lock);
+        }
+#endif
+
         ma_mutex_uninit(&AUDIO.System.lock);
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
@@ -603,6 +675,7 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->looping = false;
 
     audioBuffer->usage = usage;
+    audioBuffer->isPassthrough = ((format == AUDIO_DEVICE_FORMAT) && (format == ma_format_f32) && (channels == AUDIO_DEVICE_CHANNELS) && (sampleRate == AUDIO.System.device.sampleRate));
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
 
@@ -650,6 +723,9 @@ void PlayAudioBuffer(AudioBuffer *buffer)
         buffer->playing = true;
         buffer->paused = false;
         buffer->frameCursorPos = 0;
+        // Converter history belongs to the previous playback, or to an earlier pitched read
+        // if the straight copy path was used since then
+        ma_data_converter_reset(&buffer->converter);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -708,6 +784,9 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
         ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
         ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
 
+        // Straight copy path skips the converter, its history is stale when pitch leaves 1.0
+        if (buffer->isPassthrough && (buffer->pitch == 1.0f) && (pitch != 1.0f)) PrimeAudioBufferConverter(buffer);
+
         buffer->pitch = pitch;
         ma_mutex_unlock(&AUDIO.System.lock);
     }
@@ -936,10 +1015,14 @@ Sound LoadSoundFromWave(Wave wave)
         //
         // First option has been selected, format conversion is done on the loading stage
         // The downside is that it uses more memory if the original sound is u8 or s16
+        // NOTE: Converted sounds are mixed with a straight copy, the mixing time converter only runs when pitched
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        ma_data_converter_config converterConfig = ma_data_converter_config_init(formatIn, AUDIO_DEVICE_FORMAT, wave.channels, AUDIO_DEVICE_CHANNELS, wave.sampleRate, AUDIO.System.device.sampleRate);
+        converterConfig.resampling.linear.lpfOrder = SOUND_RESAMPLE_LPF_ORDER;
+
+        ma_uint32 frameCount = (ma_uint32)ma_convert_frames_ex(NULL, 0, wave.data, frameCountIn, &converterConfig);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
@@ -949,7 +1032,7 @@ Sound LoadSoundFromWave(Wave wave)
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        frameCount = (ma_uint32)ma_convert_frames_ex(audioBuffer->data, frameCount, wave.data, frameCountIn, &converterConfig);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
         sound.frameCount = frameCount;
@@ -1508,6 +1591,10 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        if (ma_atomic_bool32_get(&AUDIO.Music.running)) LoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1721,6 +1808,10 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        if (ma_atomic_bool32_get(&AUDIO.Music.running)) LoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1739,6 +1830,10 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) UnloadMusicDecoder(music.stream.buffer->decoder);
+#endif
+
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1771,6 +1866,28 @@ void UnloadMusicStream(Music music)
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL)
+    {
+        ma_mutex_lock(&AUDIO.Music.lock);
+
+        // Music played to the end starts again from the beginning
+        if (decoder->ended)
+        {
+            RewindMusicStream(music);
+            ResetMusicDecoder(decoder, 0);
+        }
+
+        // Ring buffer is filled up front, so playback does not wait for the decode thread
+        decoder->music.looping = music.looping;
+        FillMusicDecoder(decoder);
+
+        ma_mutex_unlock(&AUDIO.Music.lock);
+    }
+#endif
+
     PlayAudioStream(music.stream);
 }
 
@@ -1789,33 +1906,21 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+    if (decoder != NULL) ma_mutex_lock(&AUDIO.Music.lock);
+#endif
+
     StopAudioStream(music.stream);
+    RewindMusicStream(music);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (decoder != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        ResetMusicDecoder(decoder, 0);
+        ma_mutex_unlock(&AUDIO.Music.lock);
     }
+#endif
 }
 
 // Seek music to a certain position (in seconds)
@@ -1826,6 +1931,11 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+    if (decoder != NULL) ma_mutex_lock(&AUDIO.Music.lock);
+#endif
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1853,6 +1963,15 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    if (decoder != NULL)
+    {
+        ResetMusicDecoder(decoder, positionInFrames);
+        ma_mutex_unlock(&AUDIO.Music.lock);
+        return;
+    }
+#endif
+
     ma_mutex_lock(&AUDIO.System.lock);
     music.stream.buffer->framesProcessed = positionInFrames;
     ma_mutex_unlock(&AUDIO.System.lock);
@@ -1863,6 +1982,23 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music decoded on the decode thread, only looping changes have to reach it
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    if (decoder != NULL)
+    {
+        if (decoder->music.looping != music.looping)
+        {
+            ma_mutex_lock(&AUDIO.Music.lock);
+            decoder->music.looping = music.looping;
+            ma_mutex_unlock(&AUDIO.Music.lock);
+        }
+
+        return;
+    }
+#endif
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1889,116 +2025,7 @@ void UpdateMusicStream(Music music)
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        DecodeMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
@@ -2059,6 +2086,16 @@ float GetMusicTimePlayed(Music music)
     float secondsPlayed = 0.0f;
     if (music.stream.buffer != NULL)
     {
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+        // Frames processed by the mixer from the decoder ring buffer, wrapped at music length
+        if (music.stream.buffer->decoder != NULL)
+        {
+            ma_mutex_lock(&AUDIO.System.lock);
+            secondsPlayed = (float)music.stream.buffer->framesProcessed/music.stream.sampleRate;
+            ma_mutex_unlock(&AUDIO.System.lock);
+        }
+        else
+#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
@@ -2352,6 +2389,11 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         return frameCount;
     }
 
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+    // Music stream decoded on the decode thread
+    if (audioBuffer->decoder != NULL) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+#endif
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -2438,6 +2480,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
 // Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
+    // Data already in mixing format is copied straight, converter is only required to apply pitch
+    if (audioBuffer->isPassthrough && (audioBuffer->pitch == 1.0f)) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
     // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
@@ -2481,6 +2526,35 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     return totalOutputFramesProcessed;
 }
 
+// Reset converter and feed it the frames played right before the cursor, output is discarded
+// NOTE: Resampler interpolates against its last input frames, a plain reset would start from silence
+// mid-playback; stream buffers are only reset, frames before the cursor may be refilled already
+static void PrimeAudioBufferConverter(AudioBuffer *audioBuffer)
+{
+    ma_data_converter_reset(&audioBuffer->converter);
+
+    if ((audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) || (audioBuffer->data == NULL)) return;
+
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    ma_uint32 firstFrame = (audioBuffer->frameCursorPos > AUDIO_BUFFER_PRIME_FRAMES)? audioBuffer->frameCursorPos - AUDIO_BUFFER_PRIME_FRAMES : 0;
+    const unsigned char *framesIn = audioBuffer->data + firstFrame*frameSizeInBytes;
+    ma_uint64 framesRemaining = audioBuffer->frameCursorPos - firstFrame;
+
+    float framesOut[AUDIO_BUFFER_PRIME_FRAMES*8] = { 0 };
+    ma_uint64 framesOutCap = sizeof(framesOut)/ma_get_bytes_per_frame(ma_format_f32, audioBuffer->converter.channelsOut);
+
+    while (framesRemaining > 0)
+    {
+        ma_uint64 framesInProcessed = framesRemaining;
+        ma_uint64 framesOutProcessed = framesOutCap;
+        ma_data_converter_process_pcm_frames(&audioBuffer->converter, framesIn, &framesInProcessed, framesOut, &framesOutProcessed);
+        if (framesInProcessed == 0) break;
+
+        framesIn += framesInProcessed*frameSizeInBytes;
+        framesRemaining -= framesInProcessed;
+    }
+}
+
 // Sending audio data to device callback function
 // This function will be called when miniaudio needs more data
 // NOTE: All the mixing takes place here
@@ -2700,6 +2774,305 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
+// Decode music stream frames, looping formats rewind the decoder at the end of the data
+static void DecodeMusicStreamFrames(Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Seek music stream decoder to start
+static void RewindMusicStream(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_MUSIC_DECODE_THREAD)
+// Create music decoder and add it to the decode thread list
+// NOTE: Ring buffer holds MUSIC_DECODE_LATENCY_MS of decoded frames in stream format
+static void LoadMusicDecoder(Music music)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+
+    ma_uint32 ringSizeInFrames = music.stream.sampleRate*MUSIC_DECODE_LATENCY_MS/1000;
+    if (ringSizeInFrames < buffer->sizeInFrames) ringSizeInFrames = buffer->sizeInFrames;
+
+    if (ma_pcm_rb_init(buffer->converter.formatIn, buffer->converter.channelsIn, ringSizeInFrames, NULL, NULL, &decoder->ring) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decode buffer, music requires UpdateMusicStream()");
+        RL_FREE(decoder);
+        return;
+    }
+
+    decoder->music = music;
+
+    ma_mutex_lock(&AUDIO.Music.lock);
+    decoder->next = AUDIO.Music.first;
+    AUDIO.Music.first = decoder;
+    ma_mutex_unlock(&AUDIO.Music.lock);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    buffer->decoder = decoder;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Remove music decoder from the decode thread list and free it
+static void UnloadMusicDecoder(MusicDecoder *decoder)
+{
+    ma_mutex_lock(&AUDIO.Music.lock);
+    for (MusicDecoder **link = &AUDIO.Music.first; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == decoder)
+        {
+            *link = decoder->next;
+            break;
+        }
+    }
+    ma_mutex_unlock(&AUDIO.Music.lock);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    decoder->music.stream.buffer->decoder = NULL;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    ma_pcm_rb_uninit(&decoder->ring);
+    RL_FREE(decoder);
+}
+
+// Decode music frames into decoder ring buffer until it is full or music data ends
+// NOTE: Requires AUDIO.Music.lock, decoder context is not used by other threads meanwhile
+static void FillMusicDecoder(MusicDecoder *decoder)
+{
+    Music music = decoder->music;
+
+    while (!decoder->ended)
+    {
+        ma_uint32 frameCount = ma_pcm_rb_available_write(&decoder->ring);
+        if (!music.looping && (frameCount > music.frameCount - decoder->framesDecoded)) frameCount = music.frameCount - decoder->framesDecoded;
+        if (frameCount == 0) break;
+
+        // Ring buffer space is contiguous up to the wrap point, remaining space is filled on next iteration
+        void *frames = NULL;
+        ma_pcm_rb_acquire_write(&decoder->ring, &frameCount, &frames);
+        DecodeMusicStreamFrames(music, frames, frameCount);
+        ma_pcm_rb_commit_write(&decoder->ring, frameCount);
+
+        decoder->framesDecoded += frameCount;
+
+        if (music.looping) decoder->framesDecoded %= music.frameCount;
+        else if (decoder->framesDecoded >= music.frameCount)
+        {
+            // Mixer stops the stream once the ring buffer is drained
+            ma_mutex_lock(&AUDIO.System.lock);
+            decoder->ended = true;
+            ma_mutex_unlock(&AUDIO.System.lock);
+        }
+    }
+}
+
+// Drop decoded frames and restart decoding from position (in frames)
+// NOTE: Requires AUDIO.Music.lock, decoder context must be already seeked to position
+static void ResetMusicDecoder(MusicDecoder *decoder, unsigned int position)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+    ma_pcm_rb_reset(&decoder->ring);
+    decoder->ended = false;
+    decoder->music.stream.buffer->framesProcessed = position;
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    decoder->framesDecoded = position;
+}
+
+// Read decoded frames from music decoder ring buffer, missing frames are filled with silence
+// NOTE: Called from mixer with AUDIO.System.lock, ring buffer reads do not wait for the decode thread
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    MusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // Checked before reading, decode thread sets it after committing the last frames
+    bool ended = decoder->ended;
+
+    ma_uint32 framesRead = 0;
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *frames = NULL;
+
+        ma_pcm_rb_acquire_read(&decoder->ring, &framesToRead, &frames);
+        if (framesToRead == 0) break;
+
+        memcpy((unsigned char *)framesOut + framesRead*frameSizeInBytes, frames, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToRead);
+        framesRead += framesToRead;
+    }
+
+    if (decoder->music.frameCount > 0) audioBuffer->framesProcessed = (audioBuffer->framesProcessed + framesRead)%decoder->music.frameCount;
+
+    // Underrun or end of music: remaining frames are silence, at the end they also flush the converter
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+        framesRead = frameCount;
+
+        if (ended) StopAudioBufferInLockedState(audioBuffer);
+    }
+
+    return framesRead;
+}
+
+// Music decode thread, keeps the ring buffer of every music stream filled
+static ma_thread_result MA_THREADCALL MusicDecodeThread(void *data)
+{
+    (void)data;
+
+    while (ma_atomic_bool32_get(&AUDIO.Music.running))
+    {
+        ma_mutex_lock(&AUDIO.Music.lock);
+        for (MusicDecoder *decoder = AUDIO.Music.first; decoder != NULL; decoder = decoder->next) FillMusicDecoder(decoder);
+        ma_mutex_unlock(&AUDIO.Music.lock);
+
+        // Waking up 4 times per ring buffer length keeps it at least 3/4 full
+        ma_sleep(MUSIC_DECODE_LATENCY_MS/4);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
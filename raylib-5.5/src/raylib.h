@@ -426,6 +426,15 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// BakedAnimation, final bone matrices of every ModelAnimation frame
+// NOTE: Texture stores one frame per row and each bone as 4 RGBA32F texels (matrix columns)
+typedef struct BakedAnimation {
+    int boneCount;          // Number of bones
+    int frameCount;         // Number of animation frames
+    Matrix *matrices;       // Bone matrices, boneCount per frame, frames consecutive
+    Texture2D texture;      // Bone matrices texture (DrawMeshInstancedBaked()), id 0 if not supported
+} BakedAnimation;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -890,7 +899,7 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF                        // SDF font generation, requires external shader (built-in with LoadFontSDF())
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -1075,6 +1084,7 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
+RLAPI float GetFrameJitter(void);                                 // Get frame time jitter in seconds (average deviation from target frame time)
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1321,6 +1331,7 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // Image loading functions
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
+RLAPI int LoadImages(const char **fileNames, int count, Image *images);                                  // Load multiple images from files in parallel, returns number of images loaded (a same-name .qoi at least as new is preferred)
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
@@ -1462,7 +1473,10 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file as a signed distance field atlas, drawn sharp at any size with the built-in SDF shader
 RLAPI bool IsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
+RLAPI bool IsFontSDF(Font font);                                                            // Check if a font was loaded with LoadFontSDF()
+RLAPI Shader GetFontShaderSDF(void);                                                        // Get built-in shader used to draw SDF fonts (loaded on first use)
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
@@ -1572,8 +1586,10 @@ RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source,
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
+RLAPI void UnloadMeshBVH(Mesh mesh);                                                        // Unload mesh BVH used by ray queries (rebuilt on next query)
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, unsigned int instanceBufferId, int instances); // Draw multiple mesh instances with material and transforms from a vertex buffer (float16 per instance)
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
@@ -1603,10 +1619,17 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
+RLAPI void UpdateModelAnimationEx(Model model, ModelAnimation anim, int frame, bool updateNormals); // Update model animation pose (CPU), normals skinning optional
 RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI BakedAnimation LoadBakedAnimation(Model model, ModelAnimation anim);                  // Load bone matrices for every animation frame (RAM and VRAM)
+RLAPI void UnloadBakedAnimation(BakedAnimation baked);                                      // Unload baked animation data
+RLAPI void UpdateModelAnimationBaked(Model model, BakedAnimation baked, int frame, bool updateNormals); // Update model animation pose (CPU) from baked bone matrices
+RLAPI void UpdateModelAnimationBonesBaked(Model model, BakedAnimation baked, int frame);    // Update model animation mesh bone matrices (GPU skinning) from baked data
+RLAPI Shader LoadBakedAnimationShader(void);                                                // Load GPU skinning shader reading the baked bone matrices texture (OpenGL 3.3)
+RLAPI void DrawMeshInstancedBaked(Mesh mesh, Material material, BakedAnimation baked, const Matrix *transforms, const int *frames, int instances); // Draw multiple skinned mesh instances, each at its own baked frame
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
@@ -1615,6 +1638,7 @@ RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions); // Get collision info between multiple rays and mesh
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
@@ -41,6 +41,10 @@
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 *           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
 *
+*       #define SUPPORT_DEADLINE_WAIT_LOOP
+*           Pace frames against absolute deadlines, sleeping until the measured wake-up latency before the deadline
+*           and busy-waiting only that small margin
+*
 *       #define SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
@@ -90,9 +94,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -108,6 +112,7 @@
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <errno.h>                  // Required for: EINTR [Used in WaitTime()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
 #define RLGL_IMPLEMENTATION
@@ -387,6 +392,16 @@ static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_DEADLINE_WAIT_LOOP)
+static double frameDeadline = 0.0;          // Absolute time the current frame should end
+static double wakeLatency = 0.0005;         // Average sleep overshoot, measured on every wait
+static double wakeLatencyDeviation = 0.0;   // Average deviation of the sleep overshoot
+#endif
+
+#define FRAME_JITTER_HISTORY_COUNT     120  // Frames kept for GetFrameJitter(), 2 seconds at 60 FPS
+static float frameTimeHistory[FRAME_JITTER_HISTORY_COUNT] = { 0 };  // Recent frame times
+static unsigned int frameTimeHistoryCount = 0;                      // Frame times recorded, saturates at history size
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
 typedef enum AutomationEventType {
@@ -485,6 +500,11 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadMeshInstanceBuffer(void); // [Module: models] Unloads DrawMeshInstanced() instance buffers
+extern void UnloadMeshSkinningWorkers(void); // [Module: models] Stops CPU skinning worker threads
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -734,6 +754,11 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadMeshInstanceBuffer(); // WARNING: Module required: rmodels
+    UnloadMeshSkinningWorkers(); // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -943,10 +968,24 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
+    double waitSeconds = CORE.Time.target - CORE.Time.frame;
+
+#if defined(SUPPORT_DEADLINE_WAIT_LOOP)
+    // Frames end on absolute deadlines, so a late wake-up shortens the next wait instead of
+    // delaying every later frame; the deadline restarts when a frame overruns or the target changes
+    if (CORE.Time.target > 0.0)
+    {
+        double frameStart = CORE.Time.current - CORE.Time.frame;
+        frameDeadline += CORE.Time.target;
+        if ((frameDeadline < CORE.Time.current) || (frameDeadline > frameStart + CORE.Time.target)) frameDeadline = frameStart + CORE.Time.target;
+        waitSeconds = frameDeadline - CORE.Time.current;
+    }
+#endif
+
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    if (waitSeconds > 0.0)
     {
-        WaitTime(CORE.Time.target - CORE.Time.frame);
+        WaitTime(waitSeconds);
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -955,6 +994,9 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+    frameTimeHistory[CORE.Time.frameCounter%FRAME_JITTER_HISTORY_COUNT] = (float)CORE.Time.frame;
+    if (frameTimeHistoryCount < FRAME_JITTER_HISTORY_COUNT) frameTimeHistoryCount++;
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -1716,7 +1758,7 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
-#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP) || defined(SUPPORT_DEADLINE_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
 
@@ -1725,6 +1767,11 @@ void WaitTime(double seconds)
 #else
     #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
         double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
+    #elif defined(SUPPORT_DEADLINE_WAIT_LOOP)
+        // NOTE: Wake up early by the expected overshoot plus two deviations, only that margin is busy-waited
+        double sleepSeconds = seconds - (wakeLatency + 2.0*wakeLatencyDeviation);
+        if (sleepSeconds < 0.0) sleepSeconds = 0.0;
+        double sleepEnd = destinationTime - seconds + sleepSeconds;
     #else
         double sleepSeconds = seconds;
     #endif
@@ -1733,7 +1780,17 @@ void WaitTime(double seconds)
     #if defined(_WIN32)
         Sleep((unsigned long)(sleepSeconds*1000.0));
     #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    #if defined(__linux__) && defined(SUPPORT_DEADLINE_WAIT_LOOP)
+        // NOTE: Sleep to an absolute CLOCK_MONOTONIC time, so interrupted sleeps resume without drifting
+        struct timespec req = { 0 };
+        clock_gettime(CLOCK_MONOTONIC, &req);
+        long long int nsec = (long long int)req.tv_nsec + (long long int)(sleepSeconds*1000000000.0);
+        req.tv_sec += (time_t)(nsec/1000000000LL);
+        req.tv_nsec = (long)(nsec%1000000000LL);
+
+        // NOTE: clock_nanosleep() returns the error number, only EINTR is worth retrying
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &req, NULL) == EINTR) continue;
+    #elif defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
         struct timespec req = { 0 };
         time_t sec = sleepSeconds;
         long nsec = (sleepSeconds - sec)*1000000000L;
@@ -1747,12 +1804,42 @@ void WaitTime(double seconds)
         usleep(sleepSeconds*1000000.0);
     #endif
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+    #if defined(SUPPORT_DEADLINE_WAIT_LOOP)
+        // Learn the wake-up latency from this sleep (running averages, ~1/16 weight per sample)
+        if (sleepSeconds > 0.0)
+        {
+            double overshoot = GetTime() - sleepEnd;
+            if (overshoot < 0.0) overshoot = 0.0;
+            wakeLatencyDeviation += (fabs(overshoot - wakeLatency) - wakeLatencyDeviation)/16.0;
+            wakeLatency += (overshoot - wakeLatency)/16.0;
+        }
+    #endif
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP) || defined(SUPPORT_DEADLINE_WAIT_LOOP)
         while (GetTime() < destinationTime) { }
     #endif
 #endif
 }
 
+// Get frame time jitter in seconds: average absolute deviation of recent frame times
+// from the target frame time (or from their own average when no target FPS is set)
+float GetFrameJitter(void)
+{
+    if (frameTimeHistoryCount == 0) return 0.0f;
+
+    double reference = CORE.Time.target;
+    if (reference <= 0.0)
+    {
+        for (unsigned int i = 0; i < frameTimeHistoryCount; i++) reference += frameTimeHistory[i];
+        reference /= frameTimeHistoryCount;
+    }
+
+    double jitter = 0.0;
+    for (unsigned int i = 0; i < frameTimeHistoryCount; i++) jitter += fabs(frameTimeHistory[i] - reference);
+
+    return (float)(jitter/frameTimeHistoryCount);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
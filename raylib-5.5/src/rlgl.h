@@ -53,6 +53,7 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_SPRITE_QUEUE_MAX_TEXTURES       1024    // Maximum number of distinct textures in the sprite queue before it is submitted
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -221,6 +222,9 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_SPRITE_QUEUE_MAX_TEXTURES
+    #define RL_SPRITE_QUEUE_MAX_TEXTURES          1024      // Maximum number of distinct textures in the sprite queue before it is submitted
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -377,6 +381,14 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Compact batch vertex (interleaved, 16 bytes)
+// NOTE: Position is 2D and texture coordinates are normalized, so they must lie in [0..1]
+typedef struct rlVertexCompact {
+    float x, y;                 // Vertex position (XY - 2 components per vertex) (shader-location = 0)
+    unsigned short u, v;        // Vertex texture coordinates (UV, unorm16) (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (RGBA - 4 components per vertex) (shader-location = 3)
+} rlVertexCompact;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
@@ -391,8 +403,10 @@ typedef struct rlVertexBuffer {
 #if defined(GRAPHICS_API_OPENGL_ES2)
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
+    rlVertexCompact *compact;   // Interleaved vertex data, replaces the arrays above (RL_BATCH_VERTEX_COMPACT) (vboId[0])
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    void *syncFence;            // OpenGL fence signaled once the GPU is done drawing from this buffer (persistent mapping only)
 } rlVertexBuffer;
 
 // Draw call type
@@ -420,6 +434,8 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+    bool persistentMapped;      // Vertex arrays point to persistently mapped GPU memory (no upload on draw)
+    int vertexFormat;           // Vertex format (rlBatchVertexFormat)
 } rlRenderBatch;
 
 // OpenGL version
@@ -589,6 +605,12 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Render batch vertex format
+typedef enum {
+    RL_BATCH_VERTEX_DEFAULT = 0,            // Separate arrays: float3 position, float2 texcoord, float3 normal, 4 ubyte color (36 bytes)
+    RL_BATCH_VERTEX_COMPACT                 // Interleaved rlVertexCompact: float2 position, unorm16 texcoord, 4 ubyte color (16 bytes), 2D only
+} rlBatchVertexFormat;
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -620,6 +642,7 @@ RLAPI void rlEnd(void);                                 // Finish vertex providi
 RLAPI void rlVertex2i(int x, int y);                    // Define one vertex (position) - 2 int
 RLAPI void rlVertex2f(float x, float y);                // Define one vertex (position) - 2 float
 RLAPI void rlVertex3f(float x, float y, float z);       // Define one vertex (position) - 3 float
+RLAPI void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount); // Define quads from arrays (position XY, texcoord UV), 4 vertex per quad
 RLAPI void rlTexCoord2f(float x, float y);              // Define one vertex (texture coordinate) - 2 float
 RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (normal) - 3 float
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
@@ -698,12 +721,16 @@ RLAPI void rlCheckErrors(void);                         // Check and log OpenGL
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
+RLAPI void rlInvalidateStateCache(void);                // Forget cached OpenGL state, required after raw OpenGL calls that change bindings or enables
+RLAPI void rlGetStateCacheStats(unsigned int *issued, unsigned int *dropped); // Get cacheable OpenGL state calls issued and dropped as redundant
+RLAPI void rlResetStateCacheStats(void);                // Reset state cache issued/dropped counters
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
 //------------------------------------------------------------------------------------
 // rlgl initialization functions
 RLAPI void rlglInit(int width, int height);             // Initialize rlgl (buffers, shaders, textures, states)
+RLAPI void rlSetDefaultBatchVertexFormat(int format);   // Set default render batch vertex format (rlBatchVertexFormat), call before rlglInit()
 RLAPI void rlglClose(void);                             // De-initialize rlgl (buffers, shaders, textures)
 RLAPI void rlLoadExtensions(void *loader);              // Load OpenGL extensions (loader function required)
 RLAPI int rlGetVersion(void);                           // Get current OpenGL version
@@ -714,12 +741,14 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
+RLAPI unsigned int rlGetShaderIdActive(void);           // Get currently active shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements); // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int vertexFormat); // Load a render batch system with a vertex format (rlBatchVertexFormat)
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);    // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
@@ -728,6 +757,16 @@ RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Deferred sprite queue
+// NOTE: Sprites queued between rlBeginSpriteQueue() and rlEndSpriteQueue() are sorted by (layer, shader, texture, depth)
+// and submitted together, so the number of draw calls depends on distinct textures instead of submission order;
+// the queue is also submitted when the active batch is flushed for a state change (matrices, blending, scissor...)
+RLAPI void rlBeginSpriteQueue(void);                    // Begin deferred sprite queue
+RLAPI void rlEndSpriteQueue(void);                      // Sort queued sprites and submit them to the active render batch
+RLAPI bool rlIsSpriteQueueActive(void);                 // Check if sprites are being queued
+RLAPI void rlSetSpriteOrder(int layer, float depth);    // Set sort layer (0..255) and depth for next queued sprites, lower values are drawn first
+RLAPI void rlQueueSprite(unsigned int id, const float *vertices, const float *texcoords, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Queue a textured quad (4 vertex: position XY, texcoord UV), drawn right away if queue is not active
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -748,6 +787,7 @@ RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
+RLAPI bool rlIsPixelFormatSupported(int format);                          // Check if pixel format can be loaded as texture (compressed formats require GPU support)
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer); // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount); // Load texture cubemap data
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
@@ -1034,6 +1074,19 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#define RL_STATE_CACHE_UNKNOWN          0xFFFFFFFF  // Cached binding not known, next bind is always issued
+#define RL_STATE_CACHE_TEXTURE_UNITS            16  // Texture units tracked by state cache, higher units are not cached
+
+// Deferred sprite, one textured quad
+typedef struct rlSprite {
+    float vertices[8];                      // Quad vertex positions (XY), transform matrix already applied
+    float texcoords[8];                     // Quad texture coordinates (UV)
+    unsigned char color[4];                 // Quad color (RGBA)
+    unsigned int textureId;                 // Quad texture id
+    unsigned int shaderId;                  // Shader id active when queued
+    int *shaderLocs;                        // Shader locations active when queued
+} rlSprite;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
@@ -1082,6 +1135,8 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        int defaultBatchVertexFormat;       // Default batch vertex format, set before rlglInit()
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1100,11 +1155,38 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistent mapped buffers support, with fences (GL_ARB_buffer_storage, core in OpenGL 4.4)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        bool active;                        // Sprites are queued instead of drawn
+        rlSprite *sprites;                  // Queued sprites
+        unsigned long long *keys;           // Sort keys: layer (8 bit), shader slot (8 bit), texture slot (16 bit), depth (32 bit)
+        unsigned int *order;                // Sprite indices, reordered along with keys
+        unsigned long long *tempKeys;       // Radix sort scratch keys
+        unsigned int *tempOrder;            // Radix sort scratch indices
+        int count;                          // Queued sprites count
+        int capacity;                       // Allocated sprites capacity
+
+        unsigned int layer;                 // Current sort layer
+        unsigned int depth;                 // Current sort depth (float bits, flipped to sort as unsigned)
+        unsigned int shaderIds[256];        // Distinct shaders in queue, sort key stores the slot
+        int shaderCount;                    // Distinct shaders count
+        unsigned int textureIds[RL_SPRITE_QUEUE_MAX_TEXTURES];  // Distinct textures in queue, sort key stores the slot
+        int textureCount;                   // Distinct textures count
+    } SpriteQueue;      // Deferred sprite queue
+    struct {
+        unsigned int program;               // Bound shader program
+        unsigned int vao;                   // Bound vertex array object
+        unsigned int activeUnit;            // Active texture unit (offset from GL_TEXTURE0)
+        unsigned int textures[RL_STATE_CACHE_TEXTURE_UNITS];   // Bound 2D texture per texture unit
+        int capabilities[4];                // Blend, depth test, cull face, scissor test enabled state (-1 if unknown)
+        unsigned int issued;                // Cacheable calls issued to OpenGL
+        unsigned int dropped;               // Cacheable calls dropped as redundant
+    } StateCache;       // Shadow copy of OpenGL bindings and enables
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1139,6 +1221,15 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static bool rlLoadBatchVertexBuffers(rlRenderBatch *batch);     // Load render batch VAOs/VBOs (and vertex arrays)
+static void rlUnloadBatchVertexBuffers(rlRenderBatch *batch);   // Unload render batch VAOs/VBOs (and vertex arrays)
+static void rlSetBatchVertexAttribs(const rlRenderBatch *batch, const rlVertexBuffer *buffer); // Bind render batch vertex attributes to current shader
+static unsigned short rlPackUnorm16(float value);               // Pack [0..1] float into unsigned normalized 16 bit
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlWaitBatchVertexBuffer(rlVertexBuffer *buffer);    // Wait for the GPU to finish drawing from a persistent mapped buffer
+#endif
+static void rlSortSpriteQueue(void);        // Radix sort queued sprites by key
+static void rlSubmitSpriteQueue(void);      // Sort queued sprites and add them to the active render batch
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1146,6 +1237,17 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
+// State cache, OpenGL calls dropped when they would not change current state
+static void rlCacheBindTexture(unsigned int target, unsigned int id);   // Bind texture to active unit
+static void rlCacheEnable(unsigned int capability, bool enabled);       // Enable/disable OpenGL capability
+static void rlCacheForgetTexture(unsigned int id);                      // Forget deleted texture bindings
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlCacheUseProgram(unsigned int id);                         // Bind shader program
+static void rlCacheBindVertexArray(unsigned int id);                    // Bind vertex array object
+static void rlCacheActiveTexture(unsigned int unit);                    // Select active texture unit (GL_TEXTURE0 + n)
+static void rlCacheForgetProgram(unsigned int id);                      // Unbind program about to be deleted
+#endif
+
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
     float v[16];
@@ -1438,6 +1540,14 @@ void rlEnd(void) { glEnd(); }
 void rlVertex2i(int x, int y) { glVertex2i(x, y); }
 void rlVertex2f(float x, float y) { glVertex2f(x, y); }
 void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
+void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount)
+{
+    for (int i = 0; i < 4*quadCount; i++)
+    {
+        glTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        glVertex2f(vertices[2*i], vertices[2*i + 1]);
+    }
+}
 void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
 void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
@@ -1528,6 +1638,24 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    if (RLGL.currentBatch->vertexFormat == RL_BATCH_VERTEX_COMPACT)
+    {
+        // Add vertex, current texcoord and current color (normal and depth are dropped)
+        rlVertexCompact *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].compact[RLGL.State.vertexCounter];
+        vertex->x = tx;
+        vertex->y = ty;
+        vertex->u = rlPackUnorm16(RLGL.State.texcoordx);
+        vertex->v = rlPackUnorm16(RLGL.State.texcoordy);
+        vertex->r = RLGL.State.colorr;
+        vertex->g = RLGL.State.colorg;
+        vertex->b = RLGL.State.colorb;
+        vertex->a = RLGL.State.colora;
+
+        RLGL.State.vertexCounter++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+        return;
+    }
+
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1564,6 +1692,92 @@ void rlVertex2i(int x, int y)
     rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
+// Define quads from vertex arrays: position (XY) and texture coordinates (UV), 4 vertex per quad
+// NOTE: Call between rlBegin(RL_QUADS) and rlEnd(), current color and normal are used for all vertex,
+// texture coordinates are copied as a block and the batch is split if all quads do not fit
+void rlVertexQuads2f(const float *vertices, const float *texcoords, int quadCount)
+{
+    int maxQuads = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount - 1;
+
+    while (quadCount > 0)
+    {
+        int count = (quadCount < maxQuads)? quadCount : maxQuads;
+        rlCheckRenderBatchLimit(4*count);
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int first = RLGL.State.vertexCounter;
+        float depth = RLGL.currentBatch->currentDepth;
+
+        if (RLGL.currentBatch->vertexFormat == RL_BATCH_VERTEX_COMPACT)
+        {
+            for (int i = 0; i < 4*count; i++)
+            {
+                float x = vertices[2*i];
+                float y = vertices[2*i + 1];
+                rlVertexCompact *vertex = &buffer->compact[first + i];
+
+                if (RLGL.State.transformRequired)
+                {
+                    vertex->x = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*depth + RLGL.State.transform.m12;
+                    vertex->y = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*depth + RLGL.State.transform.m13;
+                }
+                else
+                {
+                    vertex->x = x;
+                    vertex->y = y;
+                }
+
+                vertex->u = rlPackUnorm16(texcoords[2*i]);
+                vertex->v = rlPackUnorm16(texcoords[2*i + 1]);
+                vertex->r = RLGL.State.colorr;
+                vertex->g = RLGL.State.colorg;
+                vertex->b = RLGL.State.colorb;
+                vertex->a = RLGL.State.colora;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < 4*count; i++)
+            {
+                float x = vertices[2*i];
+                float y = vertices[2*i + 1];
+                float *position = &buffer->vertices[3*(first + i)];
+
+                if (RLGL.State.transformRequired)
+                {
+                    position[0] = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*depth + RLGL.State.transform.m12;
+                    position[1] = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*depth + RLGL.State.transform.m13;
+                    position[2] = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*depth + RLGL.State.transform.m14;
+                }
+                else
+                {
+                    position[0] = x;
+                    position[1] = y;
+                    position[2] = depth;
+                }
+
+                buffer->normals[3*(first + i)] = RLGL.State.normalx;
+                buffer->normals[3*(first + i) + 1] = RLGL.State.normaly;
+                buffer->normals[3*(first + i) + 2] = RLGL.State.normalz;
+
+                buffer->colors[4*(first + i)] = RLGL.State.colorr;
+                buffer->colors[4*(first + i) + 1] = RLGL.State.colorg;
+                buffer->colors[4*(first + i) + 2] = RLGL.State.colorb;
+                buffer->colors[4*(first + i) + 3] = RLGL.State.colora;
+            }
+
+            memcpy(&buffer->texcoords[2*first], texcoords, 4*count*2*sizeof(float));
+        }
+
+        RLGL.State.vertexCounter += 4*count;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += 4*count;
+
+        vertices += 8*count;
+        texcoords += 8*count;
+        quadCount -= count;
+    }
+}
+
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
@@ -1680,7 +1894,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(GL_TEXTURE0 + slot);
 #endif
 }
 
@@ -1690,7 +1904,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 }
 
 // Disable texture
@@ -1699,14 +1913,14 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 #endif
 }
 
@@ -1714,14 +1928,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1763,14 +1977,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1806,7 +2020,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1814,7 +2028,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1822,7 +2036,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 #endif
 }
 
@@ -1921,16 +2135,16 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlCacheEnable(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlCacheEnable(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlCacheEnable(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlCacheEnable(GL_DEPTH_TEST, false); }
 
 // Enable depth write
 void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
@@ -1939,10 +2153,10 @@ void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
 void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlCacheEnable(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlCacheEnable(GL_CULL_FACE, false); }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1959,10 +2173,10 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void) { rlCacheEnable(GL_SCISSOR_TEST, true); }
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void) { rlCacheEnable(GL_SCISSOR_TEST, false); }
 
 // Scissor test
 void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
@@ -2097,6 +2311,7 @@ void rlSetBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
+        rlSubmitSpriteQueue();      // Queued sprites were drawn with the previous blend mode
         rlDrawRenderBatch(RLGL.currentBatch);
 
         switch (mode)
@@ -2229,13 +2444,59 @@ static void GLAPIENTRY rlDebugMessageCallback(GLenum source, GLenum type, GLuint
 }
 #endif
 
+// Forget cached OpenGL state
+// NOTE: rlgl tracks bindings and enables it issues itself, raw OpenGL calls changing
+// the same state must be followed by this so the next rlgl call is issued again
+void rlInvalidateStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.program = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.vao = RL_STATE_CACHE_UNKNOWN;
+    RLGL.StateCache.activeUnit = RL_STATE_CACHE_UNKNOWN;
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++) RLGL.StateCache.textures[i] = RL_STATE_CACHE_UNKNOWN;
+    for (int i = 0; i < 4; i++) RLGL.StateCache.capabilities[i] = -1;
+#endif
+}
+
+// Get cacheable OpenGL state calls issued and dropped as redundant
+void rlGetStateCacheStats(unsigned int *issued, unsigned int *dropped)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (issued != NULL) *issued = RLGL.StateCache.issued;
+    if (dropped != NULL) *dropped = RLGL.StateCache.dropped;
+#else
+    if (issued != NULL) *issued = 0;
+    if (dropped != NULL) *dropped = 0;
+#endif
+}
+
+// Reset state cache counters
+void rlResetStateCacheStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.StateCache.issued = 0;
+    RLGL.StateCache.dropped = 0;
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - rlgl functionality
 //----------------------------------------------------------------------------------
 
+// Set default render batch vertex format
+// NOTE: Default batch is loaded by rlglInit(), compact format suits 2D drawing with texcoords in [0..1]
+void rlSetDefaultBatchVertexFormat(int format)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.defaultBatchVertexFormat = format;
+#endif
+}
+
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+    rlInvalidateStateCache();
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2268,7 +2529,7 @@ void rlglInit(int width, int height)
     // Init default vertex arrays buffers
     // Simulate that the default shader has the location RL_SHADER_LOC_VERTEX_NORMAL to bind the normal buffer for the default render batch
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    RLGL.defaultBatch = rlLoadRenderBatchEx(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RLGL.State.defaultBatchVertexFormat);
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
     RLGL.currentBatch = &RLGL.defaultBatch;
 
@@ -2286,17 +2547,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlCacheEnable(GL_DEPTH_TEST, false);                    // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlCacheEnable(GL_BLEND, true);                          // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlCacheEnable(GL_CULL_FACE, true);                      // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2330,9 +2591,20 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload sprite queue
+    RL_FREE(RLGL.SpriteQueue.sprites);
+    RL_FREE(RLGL.SpriteQueue.keys);
+    RL_FREE(RLGL.SpriteQueue.order);
+    RL_FREE(RLGL.SpriteQueue.tempKeys);
+    RL_FREE(RLGL.SpriteQueue.tempOrder);
+    RLGL.SpriteQueue.sprites = NULL;
+    RLGL.SpriteQueue.capacity = 0;
+    RLGL.SpriteQueue.count = 0;
+
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlCacheForgetTexture(RLGL.State.defaultTextureId);
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
 }
@@ -2388,6 +2660,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && GLAD_GL_VERSION_3_2;   // Fences (glFenceSync) are core in OpenGL 3.2
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2708,6 +2981,16 @@ unsigned int rlGetShaderIdDefault(void)
     return id;
 }
 
+// Get currently active shader id
+unsigned int rlGetShaderIdActive(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Get default shader locs
 int *rlGetShaderLocsDefault(void)
 {
@@ -2722,22 +3005,28 @@ int *rlGetShaderLocsDefault(void)
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchEx(numBuffers, bufferElements, RL_BATCH_VERTEX_DEFAULT);
+}
+
+// Load render batch with a vertex format
+rlRenderBatch rlLoadRenderBatchEx(int numBuffers, int bufferElements, int vertexFormat)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    // Initialize CPU (RAM) vertex buffers (indexes)
+    // NOTE: Vertex attribute arrays (position, texcoord, normal, color) are allocated along with their VBOs,
+    // they live in RAM or, for persistent mapped batches, point straight into GPU memory
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
+    batch.bufferCount = numBuffers;    // Record buffer count
+    batch.vertexFormat = vertexFormat;
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2745,11 +3034,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2767,65 +3051,26 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
         RLGL.State.vertexCounter = 0;
     }
-
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in RAM (CPU)");
     //--------------------------------------------------------------------------------------------
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
+    // NOTE: Persistent mapping only pays off with several buffers: with a single one, every flush
+    // would have to wait for the GPU to finish drawing the previous batch before writing again
     //--------------------------------------------------------------------------------------------
-    for (int i = 0; i < numBuffers; i++)
-    {
-        if (RLGL.ExtSupported.vao)
-        {
-            // Initialize Quads VAO
-            glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
-        }
-
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-
-        // Fill index buffer
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
 #if defined(GRAPHICS_API_OPENGL_33)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
-#endif
-    }
+    batch.persistentMapped = (RLGL.ExtSupported.bufferStorage && (numBuffers > 1));
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (batch.persistentMapped && !rlLoadBatchVertexBuffers(&batch))
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular buffers");
+        rlUnloadBatchVertexBuffers(&batch);
+        batch.persistentMapped = false;
+    }
+#endif
+    if (!batch.persistentMapped) rlLoadBatchVertexBuffers(&batch);
 
-    // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU) [%i buffers, %s vertex%s]", numBuffers,
+        (vertexFormat == RL_BATCH_VERTEX_COMPACT)? "compact" : "default", batch.persistentMapped? ", persistent mapped" : "");
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2844,7 +3089,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
 
-    batch.bufferCount = numBuffers;    // Record buffer count
     batch.drawCounter = 1;             // Reset draws counter
     batch.currentDepth = -1.0f;         // Reset depth value
     //--------------------------------------------------------------------------------------------
@@ -2857,41 +3101,10 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 void rlUnloadRenderBatch(rlRenderBatch batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Unbind everything
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-
     // Unload all vertex buffers data
-    for (int i = 0; i < batch.bufferCount; i++)
-    {
-        // Unbind VAO attribs data
-        if (RLGL.ExtSupported.vao)
-        {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
-            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
-        }
-
-        // Delete VBOs from GPU (VRAM)
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+    rlUnloadBatchVertexBuffers(&batch);
 
-        // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-
-        // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].normals);
-        RL_FREE(batch.vertexBuffer[i].colors);
-        RL_FREE(batch.vertexBuffer[i].indices);
-    }
+    for (int i = 0; i < batch.bufferCount; i++) RL_FREE(batch.vertexBuffer[i].indices);
 
     // Unload arrays
     RL_FREE(batch.vertexBuffer);
@@ -2907,37 +3120,64 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+    // NOTE: Persistent mapped buffers are written in place by rlVertex*(), nothing to upload
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (use a change detector flag?)
-    if (RLGL.State.vertexCounter > 0)
+    if ((RLGL.State.vertexCounter > 0) && !batch->persistentMapped)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        if (batch->vertexFormat == RL_BATCH_VERTEX_COMPACT)
+        {
+            // Interleaved vertex buffer, one update for all attributes
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33)
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlVertexCompact), NULL, GL_DYNAMIC_DRAW);   // Orphan
+#endif
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlVertexCompact), batch->vertexBuffer[batch->currentBuffer].compact);
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+    #if defined(GRAPHICS_API_OPENGL_33)
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*3*sizeof(float), NULL, GL_DYNAMIC_DRAW);   // Orphan
+    #endif
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+    #if defined(GRAPHICS_API_OPENGL_33)
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*2*sizeof(float), NULL, GL_DYNAMIC_DRAW);   // Orphan
+    #endif
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+            // Normals buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+    #if defined(GRAPHICS_API_OPENGL_33)
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*3*sizeof(float), NULL, GL_DYNAMIC_DRAW);   // Orphan
+    #endif
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+    #if defined(GRAPHICS_API_OPENGL_33)
+            glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);   // Orphan
+    #endif
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        }
 
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
         // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer()
         // If you do that, the previous data in PBO will be discarded and glMapBuffer() returns a new
         // allocated pointer immediately even if GPU is still working with the previous data
+        // The same orphaning is done above before glBufferSubData() on OpenGL 3.3, so the upload never
+        // waits for a draw still reading the buffer; persistent mapped batches use fences instead
 
         // Another option: map the buffer object into client's memory
         // Probably this code could be moved somewhere else...
@@ -2949,7 +3189,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2978,7 +3218,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlCacheUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -3007,28 +3247,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+                // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1),
+                // normal (shader-location = 2), color (shader-location = 3)
+                rlSetBatchVertexAttribs(batch, &batch->vertexBuffer[batch->currentBuffer]);
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
@@ -3043,19 +3267,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlCacheActiveTexture(GL_TEXTURE0 + 1 + i);
+                    rlCacheBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlCacheActiveTexture(GL_TEXTURE0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlCacheBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3080,16 +3304,21 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlCacheBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlCacheUseProgram(0);    // Unbind shader program
     }
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence the buffer just drawn, it is not written again until the GPU signals it's done with it
+    if (batch->persistentMapped && (RLGL.State.vertexCounter > 0)) batch->vertexBuffer[batch->currentBuffer].syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3122,6 +3351,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Next buffer was drawn bufferCount flushes ago, usually the GPU is long done with it
+    if (batch->persistentMapped) rlWaitBatchVertexBuffer(&batch->vertexBuffer[batch->currentBuffer]);
+#endif
 #endif
 }
 
@@ -3129,6 +3363,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 void rlSetRenderBatchActive(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSubmitSpriteQueue();
     rlDrawRenderBatch(RLGL.currentBatch);
 
     if (batch != NULL) RLGL.currentBatch = batch;
@@ -3140,6 +3375,9 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 void rlDrawRenderBatchActive(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Queued sprites go first, they were queued under the state about to change
+    rlSubmitSpriteQueue();
+
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
 }
@@ -3171,6 +3409,148 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Begin deferred sprite queue
+void rlBeginSpriteQueue(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.SpriteQueue.active = true;
+    rlSetSpriteOrder(0, 0.0f);
+#endif
+}
+
+// End deferred sprite queue, sorting and submitting queued sprites
+void rlEndSpriteQueue(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlSubmitSpriteQueue();
+    RLGL.SpriteQueue.active = false;
+#endif
+}
+
+// Check if sprites are being queued
+bool rlIsSpriteQueueActive(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.SpriteQueue.active;
+#else
+    return false;
+#endif
+}
+
+// Set sort layer and depth for next queued sprites
+// NOTE: Layer is the most significant part of the sort key, so layers never interleave;
+// depth only orders sprites sharing layer, shader and texture (submission order is kept for equal keys)
+void rlSetSpriteOrder(int layer, float depth)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.SpriteQueue.layer = (unsigned int)((layer < 0)? 0 : (layer > 255)? 255 : layer);
+
+    // Flip float bits so they sort as unsigned: negatives reversed, positives above them
+    unsigned int bits = 0;
+    memcpy(&bits, &depth, sizeof(float));
+    RLGL.SpriteQueue.depth = (bits & 0x80000000)? ~bits : (bits | 0x80000000);
+#endif
+}
+
+// Queue a textured quad
+// NOTE: Vertex order is the same as rlVertexQuads2f(), current transform matrix is applied on queueing
+void rlQueueSprite(unsigned int id, const float *vertices, const float *texcoords, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.SpriteQueue.active)
+    {
+        // Find shader and texture slots, submit queue if tables are full
+        int shaderSlot = -1;
+        int textureSlot = -1;
+
+        for (int i = RLGL.SpriteQueue.shaderCount - 1; i >= 0; i--)
+        {
+            if (RLGL.SpriteQueue.shaderIds[i] == RLGL.State.currentShaderId) { shaderSlot = i; break; }
+        }
+
+        for (int i = RLGL.SpriteQueue.textureCount - 1; i >= 0; i--)
+        {
+            if (RLGL.SpriteQueue.textureIds[i] == id) { textureSlot = i; break; }
+        }
+
+        if (((shaderSlot < 0) && (RLGL.SpriteQueue.shaderCount >= 256)) ||
+            ((textureSlot < 0) && (RLGL.SpriteQueue.textureCount >= RL_SPRITE_QUEUE_MAX_TEXTURES)))
+        {
+            rlSubmitSpriteQueue();
+            shaderSlot = -1;
+            textureSlot = -1;
+        }
+
+        if (shaderSlot < 0)
+        {
+            shaderSlot = RLGL.SpriteQueue.shaderCount++;
+            RLGL.SpriteQueue.shaderIds[shaderSlot] = RLGL.State.currentShaderId;
+        }
+
+        if (textureSlot < 0)
+        {
+            textureSlot = RLGL.SpriteQueue.textureCount++;
+            RLGL.SpriteQueue.textureIds[textureSlot] = id;
+        }
+
+        // Grow queue arrays if required
+        if (RLGL.SpriteQueue.count >= RLGL.SpriteQueue.capacity)
+        {
+            int capacity = (RLGL.SpriteQueue.capacity > 0)? 2*RLGL.SpriteQueue.capacity : 1024;
+
+            RLGL.SpriteQueue.sprites = (rlSprite *)RL_REALLOC(RLGL.SpriteQueue.sprites, capacity*sizeof(rlSprite));
+            RLGL.SpriteQueue.keys = (unsigned long long *)RL_REALLOC(RLGL.SpriteQueue.keys, capacity*sizeof(unsigned long long));
+            RLGL.SpriteQueue.order = (unsigned int *)RL_REALLOC(RLGL.SpriteQueue.order, capacity*sizeof(unsigned int));
+            RLGL.SpriteQueue.tempKeys = (unsigned long long *)RL_REALLOC(RLGL.SpriteQueue.tempKeys, capacity*sizeof(unsigned long long));
+            RLGL.SpriteQueue.tempOrder = (unsigned int *)RL_REALLOC(RLGL.SpriteQueue.tempOrder, capacity*sizeof(unsigned int));
+            RLGL.SpriteQueue.capacity = capacity;
+        }
+
+        rlSprite *sprite = &RLGL.SpriteQueue.sprites[RLGL.SpriteQueue.count];
+
+        for (int i = 0; i < 4; i++)
+        {
+            float x = vertices[2*i];
+            float y = vertices[2*i + 1];
+
+            if (RLGL.State.transformRequired)
+            {
+                sprite->vertices[2*i] = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m12;
+                sprite->vertices[2*i + 1] = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m13;
+            }
+            else
+            {
+                sprite->vertices[2*i] = x;
+                sprite->vertices[2*i + 1] = y;
+            }
+        }
+
+        memcpy(sprite->texcoords, texcoords, 8*sizeof(float));
+        sprite->color[0] = r;
+        sprite->color[1] = g;
+        sprite->color[2] = b;
+        sprite->color[3] = a;
+        sprite->textureId = id;
+        sprite->shaderId = RLGL.State.currentShaderId;
+        sprite->shaderLocs = RLGL.State.currentShaderLocs;
+
+        RLGL.SpriteQueue.keys[RLGL.SpriteQueue.count] = ((unsigned long long)RLGL.SpriteQueue.layer << 56) |
+            ((unsigned long long)shaderSlot << 48) | ((unsigned long long)textureSlot << 32) | RLGL.SpriteQueue.depth;
+        RLGL.SpriteQueue.count++;
+
+        return;
+    }
+#endif
+
+    rlSetTexture(id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(r, g, b, a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);           // Normal vector pointing towards viewer
+        rlVertexQuads2f(vertices, texcoords, 1);
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3178,7 +3558,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3225,7 +3605,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3318,7 +3698,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3326,6 +3706,33 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     return id;
 }
 
+// Check if pixel format can be loaded as texture, uncompressed formats are always accepted
+// NOTE: Compressed formats depend on the extensions detected by rlLoadExtensions()
+bool rlIsPixelFormatSupported(int format)
+{
+    bool supported = (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB);
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    switch (format)
+    {
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: supported = RLGL.ExtSupported.texCompDXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: supported = RLGL.ExtSupported.texCompETC1; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: supported = RLGL.ExtSupported.texCompETC2; break;
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: supported = RLGL.ExtSupported.texCompPVRT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: supported = RLGL.ExtSupported.texCompASTC; break;
+        default: break;
+    }
+#endif
+
+    return supported;
+}
+
 // Load depth texture/renderbuffer (to be attached to fbo)
 // WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture and WebGL requires WEBGL_depth_texture extensions
 unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
@@ -3354,7 +3761,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlCacheBindTexture(GL_TEXTURE_2D, id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3362,7 +3769,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3400,7 +3807,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     unsigned int dataSize = rlGetPixelDataSize(size, size, format);
 
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3471,7 +3878,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3484,7 +3891,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3573,6 +3980,7 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+    rlCacheForgetTexture(id);
 }
 
 // Generate mipmap data for selected texture
@@ -3580,7 +3988,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3601,7 +4009,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3613,7 +4021,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3639,7 +4047,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3653,7 +4061,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer();
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3807,7 +4215,11 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE)
+    {
+        glDeleteTextures(1, &depthIdU);
+        rlCacheForgetTexture(depthIdU);
+    }
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
@@ -3908,7 +4320,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlCacheBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -3919,7 +4331,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
 #endif
 }
 
@@ -4039,7 +4451,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlCacheBindVertexArray(0);
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -4267,6 +4679,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheForgetProgram(id);
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
@@ -4704,7 +5117,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4718,9 +5131,9 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
@@ -4777,7 +5190,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4785,7 +5198,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4793,12 +5206,12 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
@@ -4979,13 +5392,14 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
 
+    rlCacheForgetProgram(RLGL.State.defaultShaderId);
     glDeleteProgram(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
@@ -4993,6 +5407,294 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Load render batch vertex buffers: one VAO and 5 VBOs per buffer, plus the vertex attribute arrays
+// NOTE: Compact vertex format uses a single interleaved VBO (vboId[0]) for all attributes.
+// For persistent mapped batches, attribute VBOs get immutable storage mapped for the whole batch
+// lifetime and the vertex arrays point into it, so rlVertex*() writes land directly in GPU-visible memory
+static bool rlLoadBatchVertexBuffers(rlRenderBatch *batch)
+{
+    bool success = true;
+
+    for (int i = 0; i < batch->bufferCount; i++)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[i];
+
+        // Vertex attributes arrays: position, texcoord, normal, color (or interleaved compact vertices)
+        void **arrays[4] = { (void **)&buffer->vertices, (void **)&buffer->texcoords, (void **)&buffer->normals, (void **)&buffer->colors };
+        int sizes[4] = {
+            buffer->elementCount*3*4*sizeof(float),             // 3 float by vertex, 4 vertex by quad
+            buffer->elementCount*2*4*sizeof(float),             // 2 float by texcoord, 4 texcoord by quad
+            buffer->elementCount*3*4*sizeof(float),             // 3 float by normal, 4 normal by quad
+            buffer->elementCount*4*4*sizeof(unsigned char)      // 4 unsigned char by color, 4 colors by quad
+        };
+        int arrayCount = 4;
+
+        if (batch->vertexFormat == RL_BATCH_VERTEX_COMPACT)
+        {
+            arrays[0] = (void **)&buffer->compact;
+            sizes[0] = buffer->elementCount*4*sizeof(rlVertexCompact);     // 4 vertex by quad
+            arrayCount = 1;
+        }
+
+        if (RLGL.ExtSupported.vao)
+        {
+            // Initialize Quads VAO
+            glGenVertexArrays(1, &buffer->vaoId);
+            rlCacheBindVertexArray(buffer->vaoId);
+        }
+
+        // Quads - Vertex buffers
+        for (int k = 0; k < arrayCount; k++)
+        {
+            glGenBuffers(1, &buffer->vboId[k]);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[k]);
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (batch->persistentMapped)
+            {
+                // Coherent mapping: writes are visible to the next draw without any explicit flush
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_ARRAY_BUFFER, sizes[k], NULL, flags);
+                *arrays[k] = glMapBufferRange(GL_ARRAY_BUFFER, 0, sizes[k], flags);
+
+                if (*arrays[k] != NULL) memset(*arrays[k], 0, sizes[k]);
+                else success = false;
+            }
+            else
+#endif
+            {
+                *arrays[k] = RL_CALLOC(sizes[k], 1);
+                glBufferData(GL_ARRAY_BUFFER, sizes[k], *arrays[k], GL_DYNAMIC_DRAW);
+            }
+        }
+
+        // Quads - Vertex attributes enable
+        rlSetBatchVertexAttribs(batch, buffer);
+
+        // Fill index buffer
+        glGenBuffers(1, &buffer->vboId[4]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[4]);
+#if defined(GRAPHICS_API_OPENGL_33)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, buffer->elementCount*6*sizeof(int), buffer->indices, GL_STATIC_DRAW);
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, buffer->elementCount*6*sizeof(short), buffer->indices, GL_STATIC_DRAW);
+#endif
+    }
+
+    // Unbind the current VAO
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+
+    return success;
+}
+
+// Bind render batch vertex buffer attributes to current shader locations
+static void rlSetBatchVertexAttribs(const rlRenderBatch *batch, const rlVertexBuffer *buffer)
+{
+    int locPosition = RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION];
+    int locTexcoord = RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01];
+    int locNormal = RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL];
+    int locColor = RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR];
+
+    if (batch->vertexFormat == RL_BATCH_VERTEX_COMPACT)
+    {
+        // Interleaved attributes, converted by the GPU: vec2 position (z = 0.0), normalized texcoord and color
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glEnableVertexAttribArray(locPosition);
+        glVertexAttribPointer(locPosition, 2, GL_FLOAT, 0, sizeof(rlVertexCompact), 0);
+        glEnableVertexAttribArray(locTexcoord);
+        glVertexAttribPointer(locTexcoord, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(rlVertexCompact), (void *)(2*sizeof(float)));
+        glEnableVertexAttribArray(locColor);
+        glVertexAttribPointer(locColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlVertexCompact), (void *)(2*sizeof(float) + 2*sizeof(unsigned short)));
+
+        // No normals stored, shaders reading them get a constant one pointing towards viewer
+        if (locNormal != -1)
+        {
+            glDisableVertexAttribArray(locNormal);
+            glVertexAttrib3f(locNormal, 0.0f, 0.0f, 1.0f);
+        }
+    }
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+        glEnableVertexAttribArray(locPosition);
+        glVertexAttribPointer(locPosition, 3, GL_FLOAT, 0, 0, 0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+        glEnableVertexAttribArray(locTexcoord);
+        glVertexAttribPointer(locTexcoord, 2, GL_FLOAT, 0, 0, 0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+        glEnableVertexAttribArray(locNormal);
+        glVertexAttribPointer(locNormal, 3, GL_FLOAT, 0, 0, 0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[3]);
+        glEnableVertexAttribArray(locColor);
+        glVertexAttribPointer(locColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+    }
+}
+
+// Pack a [0..1] float into unsigned normalized 16 bit
+static unsigned short rlPackUnorm16(float value)
+{
+    value = (value < 0.0f)? 0.0f : (value > 1.0f)? 1.0f : value;
+    return (unsigned short)(value*65535.0f + 0.5f);
+}
+
+// Unload render batch vertex buffers from GPU and vertex attribute arrays from CPU
+// NOTE: Persistent mappings are released along with their buffers
+static void rlUnloadBatchVertexBuffers(rlRenderBatch *batch)
+{
+    // Unbind everything
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    for (int i = 0; i < batch->bufferCount; i++)
+    {
+        rlVertexBuffer *buffer = &batch->vertexBuffer[i];
+
+        // Unbind VAO attribs data
+        if (RLGL.ExtSupported.vao)
+        {
+            rlCacheBindVertexArray(buffer->vaoId);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+            rlCacheBindVertexArray(0);
+        }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (buffer->syncFence != NULL) glDeleteSync((GLsync)buffer->syncFence);
+        buffer->syncFence = NULL;
+#endif
+
+        // Delete VBOs from GPU (VRAM)
+        glDeleteBuffers(5, buffer->vboId);
+        for (int k = 0; k < 5; k++) buffer->vboId[k] = 0;
+
+        // Delete VAOs from GPU (VRAM)
+        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &buffer->vaoId);
+        buffer->vaoId = 0;
+
+        // Free vertex arrays memory from CPU (RAM)
+        if (!batch->persistentMapped)
+        {
+            RL_FREE(buffer->vertices);
+            RL_FREE(buffer->texcoords);
+            RL_FREE(buffer->normals);
+            RL_FREE(buffer->colors);
+            RL_FREE(buffer->compact);
+        }
+
+        buffer->vertices = NULL;
+        buffer->texcoords = NULL;
+        buffer->normals = NULL;
+        buffer->colors = NULL;
+        buffer->compact = NULL;
+    }
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Wait for the GPU to finish drawing from a persistent mapped vertex buffer, so it can be written again
+static void rlWaitBatchVertexBuffer(rlVertexBuffer *buffer)
+{
+    if (buffer->syncFence == NULL) return;
+
+    GLsync fence = (GLsync)buffer->syncFence;
+
+    // First check doesn't flush, the fence is usually signaled already
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // 1 ms timeout (in ns)
+
+    glDeleteSync(fence);
+    buffer->syncFence = NULL;
+}
+#endif
+
+// Radix sort queued sprites by key, stable (equal keys keep submission order)
+// NOTE: One 8-bit digit per pass, passes where every key shares the digit are skipped,
+// usually leaving just the texture slot passes
+static void rlSortSpriteQueue(void)
+{
+    int count = RLGL.SpriteQueue.count;
+    unsigned long long *keys = RLGL.SpriteQueue.keys;
+    unsigned long long *tempKeys = RLGL.SpriteQueue.tempKeys;
+    unsigned int *order = RLGL.SpriteQueue.order;
+    unsigned int *tempOrder = RLGL.SpriteQueue.tempOrder;
+
+    int histograms[8][256] = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        order[i] = i;
+        for (int pass = 0; pass < 8; pass++) histograms[pass][(keys[i] >> (8*pass)) & 0xff]++;
+    }
+
+    for (int pass = 0; pass < 8; pass++)
+    {
+        int *histogram = histograms[pass];
+        if (histogram[(keys[0] >> (8*pass)) & 0xff] == count) continue;
+
+        for (int i = 0, offset = 0; i < 256; i++)
+        {
+            int digitCount = histogram[i];
+            histogram[i] = offset;
+            offset += digitCount;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            int index = histogram[(keys[i] >> (8*pass)) & 0xff]++;
+            tempKeys[index] = keys[i];
+            tempOrder[index] = order[i];
+        }
+
+        unsigned long long *swapKeys = keys; keys = tempKeys; tempKeys = swapKeys;
+        unsigned int *swapOrder = order; order = tempOrder; tempOrder = swapOrder;
+    }
+
+    // Sorted data could have ended up in scratch arrays
+    RLGL.SpriteQueue.keys = keys;
+    RLGL.SpriteQueue.tempKeys = tempKeys;
+    RLGL.SpriteQueue.order = order;
+    RLGL.SpriteQueue.tempOrder = tempOrder;
+}
+
+// Sort queued sprites and add them to the active render batch
+// NOTE: Consecutive sprites sharing shader and texture end up in the same draw call
+static void rlSubmitSpriteQueue(void)
+{
+    if (RLGL.SpriteQueue.count == 0) return;
+
+    rlSortSpriteQueue();
+
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    int *shaderLocs = RLGL.State.currentShaderLocs;
+    bool transformRequired = RLGL.State.transformRequired;
+    RLGL.State.transformRequired = false;       // Sprite vertices were transformed when queued
+
+    for (int i = 0; i < RLGL.SpriteQueue.count; i++)
+    {
+        rlSprite *sprite = &RLGL.SpriteQueue.sprites[RLGL.SpriteQueue.order[i]];
+
+        rlSetShader(sprite->shaderId, sprite->shaderLocs);
+        rlSetTexture(sprite->textureId);
+        rlBegin(RL_QUADS);
+            rlColor4ub(sprite->color[0], sprite->color[1], sprite->color[2], sprite->color[3]);
+            rlNormal3f(0.0f, 0.0f, 1.0f);
+            rlVertexQuads2f(sprite->vertices, sprite->texcoords, 1);
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+    RLGL.State.transformRequired = transformRequired;
+    rlSetShader(shaderId, shaderLocs);
+
+    RLGL.SpriteQueue.count = 0;
+    RLGL.SpriteQueue.shaderCount = 0;
+    RLGL.SpriteQueue.textureCount = 0;
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -5071,6 +5773,111 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+// State cache
+//----------------------------------------------------------------------------------
+// NOTE: Unbinds to 0 for programs and 2D textures are deferred: rlgl always binds what it draws with,
+// so the previous object can stay bound and rebinding it right after costs nothing; vertex array
+// unbinds are issued since later element buffer binds and attribute setup would modify the bound VAO
+
+// Bind texture to active unit, only GL_TEXTURE_2D bindings are cached
+static void rlCacheBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int unit = RLGL.StateCache.activeUnit;
+
+    if ((target == GL_TEXTURE_2D) && (unit < RL_STATE_CACHE_TEXTURE_UNITS))
+    {
+        if ((id == 0) && (RLGL.StateCache.textures[unit] != RL_STATE_CACHE_UNKNOWN)) { RLGL.StateCache.dropped++; return; }
+        if (RLGL.StateCache.textures[unit] == id) { RLGL.StateCache.dropped++; return; }
+        RLGL.StateCache.textures[unit] = id;
+    }
+
+    RLGL.StateCache.issued++;
+#endif
+    glBindTexture(target, id);
+}
+
+// Enable/disable OpenGL capability, blend, depth test, cull face and scissor test are cached
+static void rlCacheEnable(unsigned int capability, bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int index = -1;
+
+    switch (capability)
+    {
+        case GL_BLEND: index = 0; break;
+        case GL_DEPTH_TEST: index = 1; break;
+        case GL_CULL_FACE: index = 2; break;
+        case GL_SCISSOR_TEST: index = 3; break;
+        default: break;
+    }
+
+    if (index >= 0)
+    {
+        if (RLGL.StateCache.capabilities[index] == (int)enabled) { RLGL.StateCache.dropped++; return; }
+        RLGL.StateCache.capabilities[index] = (int)enabled;
+    }
+
+    RLGL.StateCache.issued++;
+#endif
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+}
+
+// Forget deleted texture bindings, OpenGL reverts them to 0
+static void rlCacheForgetTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    for (int i = 0; i < RL_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.StateCache.textures[i] == id) RLGL.StateCache.textures[i] = 0;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Bind shader program
+static void rlCacheUseProgram(unsigned int id)
+{
+    if ((id == 0) && (RLGL.StateCache.program != RL_STATE_CACHE_UNKNOWN)) { RLGL.StateCache.dropped++; return; }
+    if (RLGL.StateCache.program == id) { RLGL.StateCache.dropped++; return; }
+
+    RLGL.StateCache.program = id;
+    RLGL.StateCache.issued++;
+    glUseProgram(id);
+}
+
+// Bind vertex array object
+static void rlCacheBindVertexArray(unsigned int id)
+{
+    if (RLGL.StateCache.vao == id) { RLGL.StateCache.dropped++; return; }
+
+    RLGL.StateCache.vao = id;
+    RLGL.StateCache.issued++;
+    glBindVertexArray(id);
+}
+
+// Select active texture unit
+static void rlCacheActiveTexture(unsigned int unit)
+{
+    if (RLGL.StateCache.activeUnit == (unit - GL_TEXTURE0)) { RLGL.StateCache.dropped++; return; }
+
+    RLGL.StateCache.activeUnit = unit - GL_TEXTURE0;
+    RLGL.StateCache.issued++;
+    glActiveTexture(unit);
+}
+
+// Unbind program about to be deleted, a program in use is only flagged for deletion
+static void rlCacheForgetProgram(unsigned int id)
+{
+    if (RLGL.StateCache.program == id)
+    {
+        glUseProgram(0);
+        RLGL.StateCache.program = 0;
+    }
+}
+#endif
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -5110,13 +5917,14 @@ static int rlGetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks (ASTC 8x8 on 8x8 blocks),
+    // partial blocks on the edges take a full block of 8 or 16 bytes
+    if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA))
     {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        int blockSize = (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        dataSize = ((width + blockSize - 1)/blockSize)*((height + blockSize - 1)/blockSize)*(bpp*blockSize*blockSize/8);
     }
+    else if ((format >= RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) dataSize = 16;
 
     return dataSize;
 }
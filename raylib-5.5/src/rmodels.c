@@ -57,6 +57,7 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -123,6 +124,26 @@
     #define CHDIR chdir
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RMODELS_SSE2
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in SkinMeshVertices(), GetRayPacketBoxHits()]
+#endif
+
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+    #if defined(_WIN32)
+__declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+// NOTE: SRWLOCK and CONDITION_VARIABLE are a single pointer, zero-initialized
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **condition, void **lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(void **condition);
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*() [Used in SkinMeshJobs()]
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -132,16 +153,122 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MESH_SKINNING_MAX_THREADS
+    #define MESH_SKINNING_MAX_THREADS    8      // Maximum threads used to skin one mesh on CPU
+#endif
+#ifndef MESH_SKINNING_THREAD_VERTICES
+    #define MESH_SKINNING_THREAD_VERTICES    32768  // Minimum vertices skinned per thread
+#endif
+#ifndef MESH_BVH_MIN_TRIANGLES
+    #define MESH_BVH_MIN_TRIANGLES      64      // Minimum mesh triangles to build a BVH for ray queries
+#endif
+
+// Baked animation GPU skinning shader inputs, see LoadBakedAnimationShader()
+#define BAKED_ANIMATION_ATTRIB_NAME_FRAME       "instanceFrame"         // Per-instance frame index (float attribute)
+#define BAKED_ANIMATION_UNIFORM_NAME_MATRICES   "bakedBoneMatrices"     // Baked bone matrices texture (sampler2D)
+#define BAKED_ANIMATION_TEXTURE_SLOT            MAX_MATERIAL_MAPS       // Texture slot after material maps
+
+#define MESH_BVH_LEAF_TRIANGLES          4      // Triangles below which a BVH node is always a leaf
+#define MESH_BVH_MAX_LEAF_TRIANGLES     16      // Triangles above which a BVH node is always split
+#define MESH_BVH_MAX_DEPTH              48      // Maximum BVH depth, deeper nodes become leaves
+#define MESH_BVH_BINS                   12      // SAH split candidates per axis
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// CPU skinning job, range of mesh vertices skinned by one thread
+typedef struct SkinningJob {
+    const Mesh *mesh;               // Mesh to skin, base and animated vertex data
+    const float16 *bones;           // Bone matrices as column-major float16 (MatrixToFloatV())
+    int start;                      // First vertex to skin
+    int end;                        // Last vertex to skin (exclusive)
+    bool normals;                   // Skin normals too
+    bool updated;                   // Any vertex influenced by a bone
+} SkinningJob;
+
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+// CPU skinning worker threads, started on first threaded skinning and kept until CloseWindow()
+// NOTE: One batch of jobs at a time, workers and the calling thread take jobs in order
+typedef struct SkinningWorkers {
+#if defined(_WIN32)
+    void *lock;                     // SRWLOCK protecting the fields below
+    void *workReady;                // CONDITION_VARIABLE, signaled when a batch starts or on shutdown
+    void *workDone;                 // CONDITION_VARIABLE, signaled when the last job of a batch ends
+    void *threads[MESH_SKINNING_MAX_THREADS]; // Worker thread handles
+#else
+    pthread_mutex_t lock;           // Mutex protecting the fields below
+    pthread_cond_t workReady;       // Signaled when a batch starts or on shutdown
+    pthread_cond_t workDone;        // Signaled when the last job of a batch ends
+    pthread_t threads[MESH_SKINNING_MAX_THREADS]; // Worker threads
+#endif
+    int threadCount;                // Worker threads running
+    bool started;                   // Worker threads were started (even if none could be created)
+    bool stopping;                  // Workers exit when set
+    SkinningJob *jobs;              // Current batch jobs, NULL if no batch is running
+    int jobCount;                   // Current batch jobs count
+    int nextJob;                    // Next job to take from current batch
+    int pendingJobs;                // Current batch jobs not finished yet
+} SkinningWorkers;
+#endif
+
+#if defined(SUPPORT_MESH_BVH)
+// Mesh BVH node, 32 bytes, children of an inner node are consecutive
+typedef struct MeshBVHNode {
+    float min[3];                   // Bounds minimum
+    int start;                      // Leaf: first triangle (BVH order), inner: left child node
+    float max[3];                   // Bounds maximum
+    int count;                      // Leaf: triangle count, inner: 0
+} MeshBVHNode;
+
+// Mesh BVH, built on first ray query and cached by mesh vertex data
+typedef struct MeshBVH {
+    const float *vertices;          // Mesh vertex data the BVH was built from (cache key)
+    const unsigned short *indices;  // Mesh index data the BVH was built from (cache key)
+    int triangleCount;              // Mesh triangle count (cache key)
+    int nodeCount;                  // Number of nodes
+    MeshBVHNode *nodes;             // Nodes, root first
+    Vector3 *triangles;             // Triangle vertices in leaf order (mesh local space)
+} MeshBVH;
+
+// Ray packet, up to 4 rays in mesh local space traversing a BVH together
+typedef struct MeshBVHRays {
+    float ox[4], oy[4], oz[4];      // Ray origins
+    float dx[4], dy[4], dz[4];      // Ray directions
+    float ix[4], iy[4], iz[4];      // Ray direction reciprocals
+    float closest[4];               // Closest hit distance, -1 for unused lanes
+    int triangle[4];                // Closest hit triangle (BVH order), -1 if none
+} MeshBVHRays;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Instance transforms buffer shared by all DrawMeshInstanced() calls, only grows
+static unsigned int instancesVboId = 0;         // Instance transforms vertex buffer id (GPU)
+static int instancesCapacity = 0;               // Instance transforms capacity (VRAM and RAM)
+static float16 *instancesData = NULL;           // Instance transforms staging data (RAM)
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+// Instance frame indices buffer shared by all DrawMeshInstancedBaked() calls, only grows
+static unsigned int instanceFramesVboId = 0;    // Instance frames vertex buffer id (GPU)
+static int instanceFramesCapacity = 0;          // Instance frames capacity (VRAM and RAM)
+static float *instanceFramesData = NULL;        // Instance frames staging data (RAM)
+#endif
+
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+#if defined(_WIN32)
+static SkinningWorkers skinningWorkers = { 0 }; // CPU skinning worker threads
+#else
+static SkinningWorkers skinningWorkers = { .lock = PTHREAD_MUTEX_INITIALIZER, .workReady = PTHREAD_COND_INITIALIZER, .workDone = PTHREAD_COND_INITIALIZER };
+#endif
+#endif
+
+#if defined(SUPPORT_MESH_BVH)
+static MeshBVH *meshBVHs = NULL;                // Mesh BVHs built by ray queries
+static int meshBVHCount = 0;                    // Mesh BVHs count
+static int meshBVHCapacity = 0;                 // Mesh BVHs array capacity
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -168,6 +295,28 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
 
+extern void UnloadMeshInstanceBuffer(void);     // Unload instance buffers shared by DrawMeshInstanced() and DrawMeshInstancedBaked()
+extern void UnloadMeshSkinningWorkers(void);    // Stop CPU skinning worker threads
+
+static Matrix GetBoneMatrix(Transform bindPose, Transform framePose); // Get bone matrix moving a vertex from bind pose to frame pose
+static void SkinModelMeshes(Model model, bool updateNormals); // Skin model meshes on CPU with current mesh bone matrices
+static void SkinMeshVertices(SkinningJob *job); // Skin a range of mesh vertices (and normals) with blended bone matrices
+static void SkinMeshJobs(SkinningJob *jobs, int jobCount); // Run skinning jobs, on worker threads if supported
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+static void StartSkinningWorkers(void);         // Start CPU skinning worker threads
+static void RunSkinningJobs(void);              // Take and run jobs of current batch until none is left (lock held)
+static void LockSkinningWorkers(void);          // Lock skinning workers state
+static void UnlockSkinningWorkers(void);        // Unlock skinning workers state
+static void WaitSkinningWorkers(bool done);     // Wait for batch done (or work ready) signal, lock held
+static void SignalSkinningWorkers(bool done);   // Wake threads waiting for batch done (or work ready)
+#endif
+
+#if defined(SUPPORT_MESH_BVH)
+static const MeshBVH *GetMeshBVH(Mesh mesh);    // Get mesh BVH, built on first request
+static MeshBVH LoadMeshBVH(Mesh mesh);          // Build mesh BVH (binned SAH)
+static bool GetRayCollisionBVH(const Ray *rays, int rayCount, const MeshBVH *bvh, Matrix transform, RayCollision *collisions); // Get ray collisions through mesh BVH, 4 rays at a time
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -1670,10 +1819,43 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    if (instances <= 0) return;
 
+    // Grow shared instance buffer if required, capacity is doubled so
+    // per-frame drawing stops allocating once the peak instance count is reached
+    if (instances > instancesCapacity)
+    {
+        int capacity = (instancesCapacity > 0)? instancesCapacity : 64;
+        while (capacity < instances) capacity *= 2;
+
+        float16 *data = (float16 *)RL_REALLOC(instancesData, capacity*sizeof(float16));
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MESH: Failed to allocate instance transforms buffer");
+            return;
+        }
+
+        instancesData = data;
+        if (instancesVboId > 0) rlUnloadVertexBuffer(instancesVboId);
+        instancesVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(float16), true);
+        instancesCapacity = capacity;
+    }
+
+    // Fill buffer with instances transformations as float16 arrays
+    for (int i = 0; i < instances; i++) instancesData[i] = MatrixToFloatV(transforms[i]);
+
+    rlUpdateVertexBuffer(instancesVboId, instancesData, instances*sizeof(float16), 0);
+
+    DrawMeshInstancedBuffer(mesh, material, instancesVboId, instances);
+#endif
+}
+
+// Draw multiple mesh instances with material and transforms from a caller-managed vertex buffer
+// NOTE: Buffer must contain one float16 per instance (MatrixToFloatV() layout), it can be loaded
+// once with rlLoadVertexBuffer() and updated with rlUpdateVertexBuffer() when transforms change
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, unsigned int instanceBufferId, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1719,20 +1901,9 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instances buffer
     rlEnableVertexArray(mesh.vaoId);
-
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    rlEnableVertexBuffer(instanceBufferId);
 
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
     for (unsigned int i = 0; i < 4; i++)
@@ -1904,16 +2075,35 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Disable shader program
     rlDisableShader();
+#endif
+}
+
+// Unload instance buffers shared by DrawMeshInstanced() and DrawMeshInstancedBaked()
+extern void UnloadMeshInstanceBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (instancesVboId > 0) rlUnloadVertexBuffer(instancesVboId);
+    RL_FREE(instancesData);
+
+    instancesVboId = 0;
+    instancesCapacity = 0;
+    instancesData = NULL;
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (instanceFramesVboId > 0) rlUnloadVertexBuffer(instanceFramesVboId);
+    RL_FREE(instanceFramesData);
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    instanceFramesVboId = 0;
+    instanceFramesCapacity = 0;
+    instanceFramesData = NULL;
 #endif
 }
 
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    UnloadMeshBVH(mesh);
+
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
 
@@ -1935,6 +2125,33 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.boneMatrices);
 }
 
+// Unload mesh BVH used by ray queries, rebuilt on next query
+// NOTE: Required after modifying mesh.vertices or mesh.indices in place
+void UnloadMeshBVH(Mesh mesh)
+{
+#if defined(SUPPORT_MESH_BVH)
+    for (int i = 0; i < meshBVHCount; i++)
+    {
+        if (meshBVHs[i].vertices == mesh.vertices)
+        {
+            RL_FREE(meshBVHs[i].nodes);
+            RL_FREE(meshBVHs[i].triangles);
+
+            meshBVHs[i] = meshBVHs[meshBVHCount - 1];
+            meshBVHCount--;
+            break;
+        }
+    }
+
+    if (meshBVHCount == 0)
+    {
+        RL_FREE(meshBVHs);
+        meshBVHs = NULL;
+        meshBVHCapacity = 0;
+    }
+#endif
+}
+
 // Export mesh data to file
 bool ExportMesh(Mesh mesh, const char *fileName)
 {
@@ -2279,94 +2496,244 @@ void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 
                 for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
                 {
-                    Vector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    Vector3 inScale = model.bindPose[boneId].scale;
-
-                    Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    Vector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
-                    Quaternion invRotation = QuaternionInvert(inRotation);
-                    Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    Vector3 boneTranslation = Vector3Add(
-                        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
-                    Vector3 boneScale = Vector3Multiply(outScale, invScale);
-
-                    Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
-                        QuaternionToMatrix(boneRotation),
-                        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
+                    model.meshes[i].boneMatrices[boneId] = GetBoneMatrix(model.bindPose[boneId], anim.framePoses[frame][boneId]);
                 }
             }
         }
     }
 }
 
-// at least 2x speed up vs the old method 
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    UpdateModelAnimationBones(model,anim,frame);
-    for (int m = 0; m < model.meshCount; m++)
+    UpdateModelAnimationEx(model, anim, frame, true);
+}
+
+// Update model animated vertex data for a given frame, normals skinning is optional
+// NOTE: Every vertex blends its bone matrices into one and is transformed once,
+// large meshes are split across MESH_SKINNING_THREAD_VERTICES sized ranges on worker threads
+void UpdateModelAnimationEx(Model model, ModelAnimation anim, int frame, bool updateNormals)
+{
+    UpdateModelAnimationBones(model, anim, frame);
+    SkinModelMeshes(model, updateNormals);
+}
+
+// Load bone matrices for every animation frame (RAM and VRAM)
+// NOTE: Animations shared by many models are computed once, every instance then only selects a frame:
+// UpdateModelAnimationBonesBaked() copies a frame of matrices, while DrawMeshInstancedBaked() skins
+// on GPU sampling baked.texture with a per-instance frame index, texel (bone*4 + column, frame)
+BakedAnimation LoadBakedAnimation(Model model, ModelAnimation anim)
+{
+    BakedAnimation baked = { 0 };
+
+    if ((anim.frameCount <= 0) || (anim.framePoses == NULL) || (model.bindPose == NULL) || (model.boneCount != anim.boneCount))
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        TRACELOG(LOG_WARNING, "ANIM: Animation can not be baked, skeleton does not match model");
+        return baked;
+    }
+
+    baked.matrices = (Matrix *)RL_MALLOC(anim.frameCount*anim.boneCount*sizeof(Matrix));
+    if (baked.matrices == NULL) return baked;
+
+    baked.boneCount = anim.boneCount;
+    baked.frameCount = anim.frameCount;
+
+    for (int frame = 0; frame < anim.frameCount; frame++)
+    {
+        for (int boneId = 0; boneId < anim.boneCount; boneId++)
         {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
+            baked.matrices[frame*anim.boneCount + boneId] = GetBoneMatrix(model.bindPose[boneId], anim.framePoses[frame][boneId]);
+        }
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Texture rows hold matrix columns (MatrixToFloatV() layout), 4 texels per bone
+    // NOTE: Only uploaded where DrawMeshInstancedBaked() can read it with texelFetch()
+    float16 *columns = (float16 *)RL_MALLOC(anim.frameCount*anim.boneCount*sizeof(float16));
+
+    if (columns != NULL)
+    {
+        for (int i = 0; i < anim.frameCount*anim.boneCount; i++) columns[i] = MatrixToFloatV(baked.matrices[i]);
+
+        baked.texture.id = rlLoadTexture(columns, anim.boneCount*4, anim.frameCount, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+
+        if (baked.texture.id > 0)
+        {
+            baked.texture.width = anim.boneCount*4;
+            baked.texture.height = anim.frameCount;
+            baked.texture.mipmaps = 1;
+            baked.texture.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+            // Matrix texels must never be blended
+            rlTextureParameters(baked.texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            rlTextureParameters(baked.texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+        }
+
+        RL_FREE(columns);
+    }
+#endif
+
+    TRACELOG(LOG_INFO, "ANIM: Baked %i frames of %i bones", baked.frameCount, baked.boneCount);
+
+    return baked;
+}
+
+// Unload baked animation data
+void UnloadBakedAnimation(BakedAnimation baked)
+{
+    if (baked.texture.id > 0) rlUnloadTexture(baked.texture.id);
+    RL_FREE(baked.matrices);
+}
+
+// Update model animation mesh bone matrices (GPU skinning) from baked data
+// NOTE: One copy per mesh, no pose interpolation or matrix products
+void UpdateModelAnimationBonesBaked(Model model, BakedAnimation baked, int frame)
+{
+    if ((baked.frameCount > 0) && (baked.matrices != NULL))
+    {
+        if (frame >= baked.frameCount) frame = frame%baked.frameCount;
+
+        const Matrix *matrices = baked.matrices + frame*baked.boneCount;
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            if (model.meshes[i].boneMatrices)
             {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x * boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y * boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z * boneWeight;
-                updated = true;
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
+                assert(model.meshes[i].boneCount == baked.boneCount);
+
+                memcpy(model.meshes[i].boneMatrices, matrices, baked.boneCount*sizeof(Matrix));
             }
         }
-        if (updated)
+    }
+}
+
+// Update model animation pose (CPU) from baked bone matrices
+void UpdateModelAnimationBaked(Model model, BakedAnimation baked, int frame, bool updateNormals)
+{
+    UpdateModelAnimationBonesBaked(model, baked, frame);
+    SkinModelMeshes(model, updateNormals);
+}
+
+// Load GPU skinning shader for DrawMeshInstancedBaked(), uses the default fragment shader
+// NOTE: Custom shaders need the same inputs: vertexBoneIds/vertexBoneWeights, instanceTransform (mat4),
+// instanceFrame (float) attributes and bakedBoneMatrices (sampler2D) uniform
+Shader LoadBakedAnimationShader(void)
+{
+    Shader shader = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    const char *vsCode =
+        "#version 330\n"
+        "in vec3 vertexPosition;\n"
+        "in vec2 vertexTexCoord;\n"
+        "in vec4 vertexColor;\n"
+        "in vec4 vertexBoneIds;\n"
+        "in vec4 vertexBoneWeights;\n"
+        "in mat4 instanceTransform;\n"
+        "in float " BAKED_ANIMATION_ATTRIB_NAME_FRAME ";\n"
+        "uniform mat4 mvp;\n"
+        "uniform sampler2D " BAKED_ANIMATION_UNIFORM_NAME_MATRICES ";\n"
+        "out vec2 fragTexCoord;\n"
+        "out vec4 fragColor;\n"
+        "mat4 BoneMatrix(float bone, int frame)\n"
+        "{\n"
+        "    int x = int(bone)*4;\n"
+        "    return mat4(texelFetch(" BAKED_ANIMATION_UNIFORM_NAME_MATRICES ", ivec2(x, frame), 0),\n"
+        "        texelFetch(" BAKED_ANIMATION_UNIFORM_NAME_MATRICES ", ivec2(x + 1, frame), 0),\n"
+        "        texelFetch(" BAKED_ANIMATION_UNIFORM_NAME_MATRICES ", ivec2(x + 2, frame), 0),\n"
+        "        texelFetch(" BAKED_ANIMATION_UNIFORM_NAME_MATRICES ", ivec2(x + 3, frame), 0));\n"
+        "}\n"
+        "void main()\n"
+        "{\n"
+        "    int frame = int(" BAKED_ANIMATION_ATTRIB_NAME_FRAME ");\n"
+        "    mat4 skin = vertexBoneWeights.x*BoneMatrix(vertexBoneIds.x, frame) +\n"
+        "        vertexBoneWeights.y*BoneMatrix(vertexBoneIds.y, frame) +\n"
+        "        vertexBoneWeights.z*BoneMatrix(vertexBoneIds.z, frame) +\n"
+        "        vertexBoneWeights.w*BoneMatrix(vertexBoneIds.w, frame);\n"
+        "    fragTexCoord = vertexTexCoord;\n"
+        "    fragColor = vertexColor;\n"
+        "    gl_Position = mvp*instanceTransform*skin*vec4(vertexPosition, 1.0);\n"
+        "}\n";
+
+    shader = LoadShaderFromMemory(vsCode, NULL);
+
+    // Instance transforms are read from a mat4 attribute, see DrawMeshInstancedBuffer()
+    if (shader.id > 0) shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationAttrib(shader.id, "instanceTransform");
+#else
+    TRACELOG(LOG_WARNING, "ANIM: Baked animation GPU skinning requires OpenGL 3.3");
+#endif
+
+    return shader;
+}
+
+// Draw multiple skinned mesh instances, each one at its own baked animation frame (GPU skinning)
+// NOTE: Material shader must read baked.texture as LoadBakedAnimationShader() does,
+// frames wrap around baked.frameCount, mesh bone matrices are not used
+void DrawMeshInstancedBaked(Mesh mesh, Material material, BakedAnimation baked, const Matrix *transforms, const int *frames, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((instances <= 0) || (baked.texture.id == 0)) return;
+
+    int frameLoc = rlGetLocationAttrib(material.shader.id, BAKED_ANIMATION_ATTRIB_NAME_FRAME);
+    int matricesLoc = rlGetLocationUniform(material.shader.id, BAKED_ANIMATION_UNIFORM_NAME_MATRICES);
+
+    if ((frameLoc == -1) || (matricesLoc == -1))
+    {
+        TRACELOG(LOG_WARNING, "ANIM: Shader [ID %i] has no baked animation inputs, see LoadBakedAnimationShader()", material.shader.id);
+        return;
+    }
+
+    // Grow shared frames buffer if required, same policy as the instance transforms buffer
+    if (instances > instanceFramesCapacity)
+    {
+        int capacity = (instanceFramesCapacity > 0)? instanceFramesCapacity : 64;
+        while (capacity < instances) capacity *= 2;
+
+        float *data = (float *)RL_REALLOC(instanceFramesData, capacity*sizeof(float));
+        if (data == NULL)
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+            TRACELOG(LOG_WARNING, "MESH: Failed to allocate instance frames buffer");
+            return;
         }
+
+        instanceFramesData = data;
+        if (instanceFramesVboId > 0) rlUnloadVertexBuffer(instanceFramesVboId);
+        instanceFramesVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(float), true);
+        instanceFramesCapacity = capacity;
+    }
+
+    for (int i = 0; i < instances; i++)
+    {
+        int frame = frames[i]%baked.frameCount;
+        if (frame < 0) frame += baked.frameCount;
+        instanceFramesData[i] = (float)frame;
     }
+
+    rlUpdateVertexBuffer(instanceFramesVboId, instanceFramesData, instances*sizeof(float), 0);
+
+    // Attach frames buffer to mesh VAO, one value per instance
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(instanceFramesVboId);
+    rlEnableVertexAttribute(frameLoc);
+    rlSetVertexAttribute(frameLoc, 1, RL_FLOAT, 0, 0, 0);
+    rlSetVertexAttributeDivisor(frameLoc, 1);
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+
+    // Bind bone matrices texture after the material maps, DrawMeshInstancedBuffer() keeps the program bound
+    int slot = BAKED_ANIMATION_TEXTURE_SLOT;
+    rlEnableShader(material.shader.id);
+    rlActiveTextureSlot(slot);
+    rlEnableTexture(baked.texture.id);
+    rlSetUniform(matricesLoc, &slot, SHADER_UNIFORM_INT, 1);
+
+    DrawMeshInstanced(mesh, material, transforms, instances);
+
+    rlActiveTextureSlot(slot);
+    rlDisableTexture();
+    rlActiveTextureSlot(0);
+#endif
 }
 
 // Unload animation array data
@@ -4044,6 +4411,11 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     // Check if mesh vertex data on CPU for testing
     if (mesh.vertices != NULL)
     {
+#if defined(SUPPORT_MESH_BVH)
+        // Large meshes are tested through a BVH, falls back to all triangles if transform can not be inverted
+        const MeshBVH *bvh = GetMeshBVH(mesh);
+        if ((bvh != NULL) && GetRayCollisionBVH(&ray, 1, bvh, transform, &collision)) return collision;
+#endif
         int triangleCount = mesh.triangleCount;
 
         // Test against all triangles in mesh
@@ -4082,6 +4454,23 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     return collision;
 }
 
+// Get collision info between multiple rays and mesh, one collision per ray
+// NOTE: Rays share one BVH traversal 4 at a time, coherent rays (picking, sweeps) benefit most
+void GetRayCollisionMeshBatch(const Ray *rays, int rayCount, Mesh mesh, Matrix transform, RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (rayCount <= 0)) return;
+
+#if defined(SUPPORT_MESH_BVH)
+    if (mesh.vertices != NULL)
+    {
+        const MeshBVH *bvh = GetMeshBVH(mesh);
+        if ((bvh != NULL) && GetRayCollisionBVH(rays, rayCount, bvh, transform, collisions)) return;
+    }
+#endif
+
+    for (int i = 0; i < rayCount; i++) collisions[i] = GetRayCollisionMesh(rays[i], mesh, transform);
+}
+
 // Get collision info between ray and triangle
 // NOTE: The points are expected to be in counter-clockwise winding
 // NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
@@ -4181,6 +4570,792 @@ static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform
 }
 #endif
 
+// Get bone matrix moving a vertex from bind pose to frame pose
+static Matrix GetBoneMatrix(Transform bindPose, Transform framePose)
+{
+    Vector3 inTranslation = bindPose.translation;
+    Quaternion inRotation = bindPose.rotation;
+    Vector3 inScale = bindPose.scale;
+
+    Vector3 outTranslation = framePose.translation;
+    Quaternion outRotation = framePose.rotation;
+    Vector3 outScale = framePose.scale;
+
+    Vector3 invTranslation = Vector3RotateByQuaternion(Vector3Negate(inTranslation), QuaternionInvert(inRotation));
+    Quaternion invRotation = QuaternionInvert(inRotation);
+    Vector3 invScale = Vector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+    Vector3 boneTranslation = Vector3Add(
+        Vector3RotateByQuaternion(Vector3Multiply(outScale, invTranslation),
+        outRotation), outTranslation);
+    Quaternion boneRotation = QuaternionMultiply(outRotation, invRotation);
+    Vector3 boneScale = Vector3Multiply(outScale, invScale);
+
+    Matrix boneMatrix = MatrixMultiply(MatrixMultiply(
+        QuaternionToMatrix(boneRotation),
+        MatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+        MatrixScale(boneScale.x, boneScale.y, boneScale.z));
+
+    return boneMatrix;
+}
+
+// Skin model meshes on CPU with current mesh bone matrices
+static void SkinModelMeshes(Model model, bool updateNormals)
+{
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+
+        if ((mesh.animVertices == NULL) || (mesh.boneIds == NULL) || (mesh.boneWeights == NULL) || (mesh.boneMatrices == NULL)) continue;
+
+        // Bone ids are stored as unsigned char, so there are at most 256 bones
+        float16 bones[256] = { 0 };
+        int boneCount = (mesh.boneCount < 256)? mesh.boneCount : 256;
+        for (int b = 0; b < boneCount; b++) bones[b] = MatrixToFloatV(mesh.boneMatrices[b]);
+
+        bool normals = updateNormals && (mesh.normals != NULL) && (mesh.animNormals != NULL);
+
+        int jobCount = 1;
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+        jobCount = mesh.vertexCount/MESH_SKINNING_THREAD_VERTICES;
+        if (jobCount > MESH_SKINNING_MAX_THREADS) jobCount = MESH_SKINNING_MAX_THREADS;
+        if (jobCount < 1) jobCount = 1;
+#endif
+        SkinningJob jobs[MESH_SKINNING_MAX_THREADS] = { 0 };
+        for (int j = 0; j < jobCount; j++)
+        {
+            jobs[j].mesh = &model.meshes[m];
+            jobs[j].bones = bones;
+            jobs[j].start = (int)((long long)mesh.vertexCount*j/jobCount);
+            jobs[j].end = (int)((long long)mesh.vertexCount*(j + 1)/jobCount);
+            jobs[j].normals = normals;
+        }
+
+        SkinMeshJobs(jobs, jobCount);
+
+        bool updated = false;   // Flag to check when anim vertex information is updated
+        for (int j = 0; j < jobCount; j++) updated |= jobs[j].updated;
+
+        // NOTE: Meshes not uploaded to GPU yet are only skinned on CPU
+        if (updated && (mesh.vboId != NULL))
+        {
+            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
+            if (normals) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+        }
+    }
+}
+
+// Skin a range of mesh vertices (and normals) with blended bone matrices
+// NOTE: Weighted sum of transformed vertices equals vertex transformed by weighted sum of matrices,
+// so the (up to 4) bone matrices are blended first and every vertex is transformed only once
+static void SkinMeshVertices(SkinningJob *job)
+{
+    const Mesh *mesh = job->mesh;
+    bool updated = false;
+
+    for (int v = job->start; v < job->end; v++)
+    {
+        const float *vertex = mesh->vertices + v*3;
+        float *animVertex = mesh->animVertices + v*3;
+        const float *weights = mesh->boneWeights + v*4;
+        const unsigned char *ids = mesh->boneIds + v*4;
+
+#if defined(RMODELS_SSE2)
+        __m128 col0 = _mm_setzero_ps();
+        __m128 col1 = _mm_setzero_ps();
+        __m128 col2 = _mm_setzero_ps();
+        __m128 col3 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            // Early stop when no transformation will be applied
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = job->bones[ids[j]].v;
+            __m128 weight = _mm_set1_ps(weights[j]);
+            col0 = _mm_add_ps(col0, _mm_mul_ps(weight, _mm_loadu_ps(bone)));
+            col1 = _mm_add_ps(col1, _mm_mul_ps(weight, _mm_loadu_ps(bone + 4)));
+            col2 = _mm_add_ps(col2, _mm_mul_ps(weight, _mm_loadu_ps(bone + 8)));
+            col3 = _mm_add_ps(col3, _mm_mul_ps(weight, _mm_loadu_ps(bone + 12)));
+            updated = true;
+        }
+
+        __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[0]), col0), _mm_mul_ps(_mm_set1_ps(vertex[1]), col1)),
+                                   _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[2]), col2), col3));
+
+        // NOTE: Only 3 floats are stored, writing 4 would overrun the range of the next job
+        _mm_storel_pi((__m64 *)animVertex, result);
+        _mm_store_ss(animVertex + 2, _mm_movehl_ps(result, result));
+
+        if (job->normals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(normal[0]), col0), _mm_mul_ps(_mm_set1_ps(normal[1]), col1)),
+                                _mm_mul_ps(_mm_set1_ps(normal[2]), col2));
+
+            _mm_storel_pi((__m64 *)animNormal, result);
+            _mm_store_ss(animNormal + 2, _mm_movehl_ps(result, result));
+        }
+#else
+        float m[16] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            // Early stop when no transformation will be applied
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = job->bones[ids[j]].v;
+            for (int k = 0; k < 16; k++) m[k] += weights[j]*bone[k];
+            updated = true;
+        }
+
+        float x = vertex[0], y = vertex[1], z = vertex[2];
+        animVertex[0] = m[0]*x + m[4]*y + m[8]*z + m[12];
+        animVertex[1] = m[1]*x + m[5]*y + m[9]*z + m[13];
+        animVertex[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+
+        if (job->normals)
+        {
+            const float *normal = mesh->normals + v*3;
+            float *animNormal = mesh->animNormals + v*3;
+
+            x = normal[0]; y = normal[1]; z = normal[2];
+            animNormal[0] = m[0]*x + m[4]*y + m[8]*z;
+            animNormal[1] = m[1]*x + m[5]*y + m[9]*z;
+            animNormal[2] = m[2]*x + m[6]*y + m[10]*z;
+        }
+#endif
+    }
+
+    job->updated = updated;
+}
+
+// Run skinning jobs, on worker threads if supported
+// NOTE: Calling thread runs jobs too, so a batch completes even if no worker could be started;
+// a batch requested while another one is running (from another thread) runs on the calling thread
+static void SkinMeshJobs(SkinningJob *jobs, int jobCount)
+{
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+    if (jobCount > 1)
+    {
+        LockSkinningWorkers();
+
+        if (!skinningWorkers.started) StartSkinningWorkers();
+
+        if (skinningWorkers.jobs == NULL)
+        {
+            skinningWorkers.jobs = jobs;
+            skinningWorkers.jobCount = jobCount;
+            skinningWorkers.nextJob = 0;
+            skinningWorkers.pendingJobs = jobCount;
+            SignalSkinningWorkers(false);
+
+            RunSkinningJobs();
+            while (skinningWorkers.pendingJobs > 0) WaitSkinningWorkers(true);
+
+            skinningWorkers.jobs = NULL;
+            skinningWorkers.jobCount = 0;
+            skinningWorkers.nextJob = 0;
+
+            UnlockSkinningWorkers();
+            return;
+        }
+
+        UnlockSkinningWorkers();
+    }
+#endif
+    for (int j = 0; j < jobCount; j++) SkinMeshVertices(&jobs[j]);
+}
+
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+// Skinning worker thread, runs jobs of every batch until shutdown
+#if defined(_WIN32)
+static unsigned long __stdcall SkinningWorkerThread(void *arg)
+#else
+static void *SkinningWorkerThread(void *arg)
+#endif
+{
+    (void)arg;
+
+    LockSkinningWorkers();
+    while (!skinningWorkers.stopping)
+    {
+        if ((skinningWorkers.jobs != NULL) && (skinningWorkers.nextJob < skinningWorkers.jobCount)) RunSkinningJobs();
+        else WaitSkinningWorkers(false);
+    }
+    UnlockSkinningWorkers();
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+// Start CPU skinning worker threads, one less than the maximum jobs (calling thread runs jobs too)
+// NOTE: Called with lock held, workers block on it until the first batch is set up
+static void StartSkinningWorkers(void)
+{
+    skinningWorkers.started = true;
+    skinningWorkers.stopping = false;
+    skinningWorkers.threadCount = 0;
+
+    for (int i = 0; i < MESH_SKINNING_MAX_THREADS - 1; i++)
+    {
+#if defined(_WIN32)
+        void *thread = CreateThread(NULL, 0, SkinningWorkerThread, NULL, 0, NULL);
+        if (thread == NULL) break;
+        skinningWorkers.threads[skinningWorkers.threadCount] = thread;
+#else
+        if (pthread_create(&skinningWorkers.threads[skinningWorkers.threadCount], NULL, SkinningWorkerThread, NULL) != 0) break;
+#endif
+        skinningWorkers.threadCount++;
+    }
+
+    if (skinningWorkers.threadCount < MESH_SKINNING_MAX_THREADS - 1) TRACELOG(LOG_WARNING, "MESH: Started %i of %i skinning worker threads", skinningWorkers.threadCount, MESH_SKINNING_MAX_THREADS - 1);
+}
+
+// Take and run jobs of current batch until none is left, lock is released while a job runs
+static void RunSkinningJobs(void)
+{
+    while ((skinningWorkers.jobs != NULL) && (skinningWorkers.nextJob < skinningWorkers.jobCount))
+    {
+        SkinningJob *job = &skinningWorkers.jobs[skinningWorkers.nextJob++];
+
+        UnlockSkinningWorkers();
+        SkinMeshVertices(job);
+        LockSkinningWorkers();
+
+        skinningWorkers.pendingJobs--;
+        if (skinningWorkers.pendingJobs == 0) SignalSkinningWorkers(true);
+    }
+}
+
+// Lock skinning workers state
+static void LockSkinningWorkers(void)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&skinningWorkers.lock);
+#else
+    pthread_mutex_lock(&skinningWorkers.lock);
+#endif
+}
+
+// Unlock skinning workers state
+static void UnlockSkinningWorkers(void)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&skinningWorkers.lock);
+#else
+    pthread_mutex_unlock(&skinningWorkers.lock);
+#endif
+}
+
+// Wait for batch done (or work ready) signal, lock must be held
+static void WaitSkinningWorkers(bool done)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(done? &skinningWorkers.workDone : &skinningWorkers.workReady, &skinningWorkers.lock, 0xFFFFFFFF, 0);    // INFINITE
+#else
+    pthread_cond_wait(done? &skinningWorkers.workDone : &skinningWorkers.workReady, &skinningWorkers.lock);
+#endif
+}
+
+// Wake threads waiting for batch done (or work ready)
+static void SignalSkinningWorkers(bool done)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(done? &skinningWorkers.workDone : &skinningWorkers.workReady);
+#else
+    pthread_cond_broadcast(done? &skinningWorkers.workDone : &skinningWorkers.workReady);
+#endif
+}
+#endif
+
+// Stop CPU skinning worker threads, next threaded skinning starts them again
+extern void UnloadMeshSkinningWorkers(void)
+{
+#if defined(SUPPORT_MESH_SKINNING_THREADS)
+    LockSkinningWorkers();
+    skinningWorkers.stopping = true;
+    SignalSkinningWorkers(false);
+    UnlockSkinningWorkers();
+
+    for (int i = 0; i < skinningWorkers.threadCount; i++)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(skinningWorkers.threads[i], 0xFFFFFFFF);    // INFINITE
+        CloseHandle(skinningWorkers.threads[i]);
+#else
+        pthread_join(skinningWorkers.threads[i], NULL);
+#endif
+    }
+
+    skinningWorkers.threadCount = 0;
+    skinningWorkers.started = false;
+    skinningWorkers.stopping = false;
+#endif
+}
+
+#if defined(SUPPORT_MESH_BVH)
+// Get mesh BVH, built on first request
+// NOTE: Returns NULL for small meshes, testing all their triangles is faster
+static const MeshBVH *GetMeshBVH(Mesh mesh)
+{
+    if ((mesh.vertices == NULL) || (mesh.triangleCount < MESH_BVH_MIN_TRIANGLES)) return NULL;
+
+    for (int i = 0; i < meshBVHCount; i++)
+    {
+        if (meshBVHs[i].vertices == mesh.vertices)
+        {
+            if ((meshBVHs[i].indices == mesh.indices) && (meshBVHs[i].triangleCount == mesh.triangleCount)) return &meshBVHs[i];
+
+            // Mesh data changed, rebuild
+            UnloadMeshBVH(mesh);
+            break;
+        }
+    }
+
+    if (meshBVHCount == meshBVHCapacity)
+    {
+        int capacity = (meshBVHCapacity > 0)? meshBVHCapacity*2 : 8;
+        MeshBVH *bvhs = (MeshBVH *)RL_REALLOC(meshBVHs, capacity*sizeof(MeshBVH));
+        if (bvhs == NULL) return NULL;
+
+        meshBVHs = bvhs;
+        meshBVHCapacity = capacity;
+    }
+
+    MeshBVH bvh = LoadMeshBVH(mesh);
+    if (bvh.nodes == NULL) return NULL;
+
+    meshBVHs[meshBVHCount] = bvh;
+    meshBVHCount++;
+
+    return &meshBVHs[meshBVHCount - 1];
+}
+
+// Get bounding box surface area (half), SAH cost weight
+static float GetBoxHalfArea(Vector3 min, Vector3 max)
+{
+    Vector3 size = Vector3Subtract(max, min);
+    return size.x*size.y + size.y*size.z + size.z*size.x;
+}
+
+// Grow bounds to include other bounds
+// NOTE: Plain comparisons, Vector3Min()/Vector3Max() call fminf()/fmaxf() per component
+static void GrowBounds(Vector3 *min, Vector3 *max, Vector3 otherMin, Vector3 otherMax)
+{
+    min->x = (otherMin.x < min->x)? otherMin.x : min->x;
+    min->y = (otherMin.y < min->y)? otherMin.y : min->y;
+    min->z = (otherMin.z < min->z)? otherMin.z : min->z;
+    max->x = (otherMax.x > max->x)? otherMax.x : max->x;
+    max->y = (otherMax.y > max->y)? otherMax.y : max->y;
+    max->z = (otherMax.z > max->z)? otherMax.z : max->z;
+}
+
+// Build mesh BVH (binned SAH)
+// NOTE: Nodes are split in creation order, so children always follow their parent in the array
+static MeshBVH LoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+    int triangleCount = mesh.triangleCount;
+    const Vector3 *vertices = (const Vector3 *)mesh.vertices;
+
+    Vector3 *triMin = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    Vector3 *triMax = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    Vector3 *centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    int *order = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    unsigned char *depths = (unsigned char *)RL_CALLOC(2*triangleCount, 1);
+    bvh.nodes = (MeshBVHNode *)RL_MALLOC(2*triangleCount*sizeof(MeshBVHNode));
+
+    if ((triMin == NULL) || (triMax == NULL) || (centroids == NULL) || (order == NULL) || (depths == NULL) || (bvh.nodes == NULL))
+    {
+        RL_FREE(bvh.nodes);
+        bvh.nodes = NULL;
+    }
+    else
+    {
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a = mesh.indices? vertices[mesh.indices[i*3]] : vertices[i*3];
+            Vector3 b = mesh.indices? vertices[mesh.indices[i*3 + 1]] : vertices[i*3 + 1];
+            Vector3 c = mesh.indices? vertices[mesh.indices[i*3 + 2]] : vertices[i*3 + 2];
+
+            triMin[i] = Vector3Min(a, Vector3Min(b, c));
+            triMax[i] = Vector3Max(a, Vector3Max(b, c));
+            centroids[i] = Vector3Scale(Vector3Add(triMin[i], triMax[i]), 0.5f);
+            order[i] = i;
+        }
+
+        bvh.nodes[0].start = 0;
+        bvh.nodes[0].count = triangleCount;
+        bvh.nodeCount = 1;
+
+        for (int n = 0; n < bvh.nodeCount; n++)
+        {
+            MeshBVHNode *node = &bvh.nodes[n];
+            int start = node->start;
+            int count = node->count;
+
+            // Node bounds and centroid bounds
+            Vector3 min = triMin[start], max = triMax[start];
+            Vector3 cmin = centroids[start], cmax = cmin;
+            for (int i = start + 1; i < start + count; i++)
+            {
+                GrowBounds(&min, &max, triMin[i], triMax[i]);
+                GrowBounds(&cmin, &cmax, centroids[i], centroids[i]);
+            }
+
+            node->min[0] = min.x; node->min[1] = min.y; node->min[2] = min.z;
+            node->max[0] = max.x; node->max[1] = max.y; node->max[2] = max.z;
+
+            if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depths[n] >= MESH_BVH_MAX_DEPTH)) continue;
+
+            // Find lowest cost split among bin boundaries of all 3 axis, binned in one pass
+            float bestCost = GetBoxHalfArea(min, max)*count;
+            int bestAxis = -1;
+            int bestSplit = 0;
+
+            int binCount[3][MESH_BVH_BINS] = { 0 };
+            Vector3 binMin[3][MESH_BVH_BINS], binMax[3][MESH_BVH_BINS];
+            float scale[3] = { 0 };
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                float axisExtent = (&cmax.x)[axis] - (&cmin.x)[axis];
+                if (axisExtent > 0.0f) scale[axis] = MESH_BVH_BINS/axisExtent;
+            }
+
+            for (int i = start; i < start + count; i++)
+            {
+                for (int axis = 0; axis < 3; axis++)
+                {
+                    int bin = (int)(((&centroids[i].x)[axis] - (&cmin.x)[axis])*scale[axis]);
+                    if (bin >= MESH_BVH_BINS) bin = MESH_BVH_BINS - 1;
+
+                    if (binCount[axis][bin] == 0) { binMin[axis][bin] = triMin[i]; binMax[axis][bin] = triMax[i]; }
+                    else GrowBounds(&binMin[axis][bin], &binMax[axis][bin], triMin[i], triMax[i]);
+                    binCount[axis][bin]++;
+                }
+            }
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                if (scale[axis] == 0.0f) continue;
+
+                // Sweep from both sides: left[i] covers bins 0..i, right side is accumulated backwards
+                float leftArea[MESH_BVH_BINS - 1];
+                int leftCount[MESH_BVH_BINS - 1];
+                Vector3 accMin = { 0 }, accMax = { 0 };
+                int accCount = 0;
+
+                for (int i = 0; i < MESH_BVH_BINS - 1; i++)
+                {
+                    if (binCount[axis][i] > 0)
+                    {
+                        if (accCount == 0) { accMin = binMin[axis][i]; accMax = binMax[axis][i]; }
+                        else GrowBounds(&accMin, &accMax, binMin[axis][i], binMax[axis][i]);
+                        accCount += binCount[axis][i];
+                    }
+
+                    leftArea[i] = (accCount > 0)? GetBoxHalfArea(accMin, accMax) : 0.0f;
+                    leftCount[i] = accCount;
+                }
+
+                accCount = 0;
+                for (int i = MESH_BVH_BINS - 1; i > 0; i--)
+                {
+                    if (binCount[axis][i] > 0)
+                    {
+                        if (accCount == 0) { accMin = binMin[axis][i]; accMax = binMax[axis][i]; }
+                        else GrowBounds(&accMin, &accMax, binMin[axis][i], binMax[axis][i]);
+                        accCount += binCount[axis][i];
+                    }
+
+                    if ((accCount == 0) || (leftCount[i - 1] == 0)) continue;
+
+                    float cost = leftArea[i - 1]*leftCount[i - 1] + GetBoxHalfArea(accMin, accMax)*accCount;
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = i;
+                    }
+                }
+            }
+
+            if (bestAxis == -1)
+            {
+                if (count <= MESH_BVH_MAX_LEAF_TRIANGLES) continue;
+
+                // No split beats a leaf but node is too big, split at median of longest centroid axis
+                Vector3 extent = Vector3Subtract(cmax, cmin);
+                bestAxis = ((extent.x >= extent.y) && (extent.x >= extent.z))? 0 : ((extent.y >= extent.z)? 1 : 2);
+                if ((&extent.x)[bestAxis] <= 0.0f) continue;    // All centroids match, keep big leaf
+                bestSplit = MESH_BVH_BINS/2;
+            }
+
+            // Partition triangles by split bin, bounds are swapped along so nodes read them sequentially
+            float axisMin = (&cmin.x)[bestAxis];
+            float axisScale = MESH_BVH_BINS/((&cmax.x)[bestAxis] - axisMin);
+            int mid = start;
+
+            for (int i = start; i < start + count; i++)
+            {
+                int bin = (int)(((&centroids[i].x)[bestAxis] - axisMin)*axisScale);
+                if (bin >= MESH_BVH_BINS) bin = MESH_BVH_BINS - 1;
+
+                if (bin < bestSplit)
+                {
+                    int t = order[i]; order[i] = order[mid]; order[mid] = t;
+                    Vector3 v = triMin[i]; triMin[i] = triMin[mid]; triMin[mid] = v;
+                    v = triMax[i]; triMax[i] = triMax[mid]; triMax[mid] = v;
+                    v = centroids[i]; centroids[i] = centroids[mid]; centroids[mid] = v;
+                    mid++;
+                }
+            }
+
+            if ((mid == start) || (mid == start + count)) continue;
+
+            int left = bvh.nodeCount;
+            bvh.nodes[left].start = start;
+            bvh.nodes[left].count = mid - start;
+            bvh.nodes[left + 1].start = mid;
+            bvh.nodes[left + 1].count = start + count - mid;
+            depths[left] = depths[left + 1] = depths[n] + 1;
+            bvh.nodeCount += 2;
+
+            node->start = left;
+            node->count = 0;
+        }
+
+        // Store triangle vertices in leaf order, so leaves read contiguous memory
+        bvh.triangles = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+
+        if (bvh.triangles != NULL)
+        {
+            for (int i = 0; i < triangleCount; i++)
+            {
+                int t = order[i];
+                bvh.triangles[i*3] = mesh.indices? vertices[mesh.indices[t*3]] : vertices[t*3];
+                bvh.triangles[i*3 + 1] = mesh.indices? vertices[mesh.indices[t*3 + 1]] : vertices[t*3 + 1];
+                bvh.triangles[i*3 + 2] = mesh.indices? vertices[mesh.indices[t*3 + 2]] : vertices[t*3 + 2];
+            }
+
+            bvh.vertices = mesh.vertices;
+            bvh.indices = mesh.indices;
+            bvh.triangleCount = triangleCount;
+
+            TRACELOG(LOG_DEBUG, "MESH: BVH built for %i triangles (%i nodes)", triangleCount, bvh.nodeCount);
+        }
+        else
+        {
+            RL_FREE(bvh.nodes);
+            bvh.nodes = NULL;
+        }
+    }
+
+    RL_FREE(triMin);
+    RL_FREE(triMax);
+    RL_FREE(centroids);
+    RL_FREE(order);
+    RL_FREE(depths);
+
+    return bvh;
+}
+
+// Test ray packet against node bounds, returns lanes mask of rays entering before their closest hit
+// NOTE: Slab test, entry receives the nearest entry distance of hit lanes
+static int GetRayPacketBoxHits(const MeshBVHRays *rays, const MeshBVHNode *node, float *entry)
+{
+    int mask = 0;
+
+#if defined(RMODELS_SSE2)
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min[0]), _mm_loadu_ps(rays->ox)), _mm_loadu_ps(rays->ix));
+    __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max[0]), _mm_loadu_ps(rays->ox)), _mm_loadu_ps(rays->ix));
+    __m128 tnear = _mm_max_ps(_mm_min_ps(t1, t2), _mm_setzero_ps());
+    __m128 tfar = _mm_min_ps(_mm_max_ps(t1, t2), _mm_loadu_ps(rays->closest));
+
+    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min[1]), _mm_loadu_ps(rays->oy)), _mm_loadu_ps(rays->iy));
+    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max[1]), _mm_loadu_ps(rays->oy)), _mm_loadu_ps(rays->iy));
+    tnear = _mm_max_ps(tnear, _mm_min_ps(t1, t2));
+    tfar = _mm_min_ps(tfar, _mm_max_ps(t1, t2));
+
+    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min[2]), _mm_loadu_ps(rays->oz)), _mm_loadu_ps(rays->iz));
+    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max[2]), _mm_loadu_ps(rays->oz)), _mm_loadu_ps(rays->iz));
+    tnear = _mm_max_ps(tnear, _mm_min_ps(t1, t2));
+    tfar = _mm_min_ps(tfar, _mm_max_ps(t1, t2));
+
+    __m128 hit = _mm_cmple_ps(tnear, tfar);
+    mask = _mm_movemask_ps(hit);
+
+    if (mask != 0)
+    {
+        float distances[4];
+        _mm_storeu_ps(distances, tnear);
+
+        *entry = FLT_MAX;
+        for (int i = 0; i < 4; i++) if ((mask & (1 << i)) && (distances[i] < *entry)) *entry = distances[i];
+    }
+#else
+    *entry = FLT_MAX;
+
+    for (int i = 0; i < 4; i++)
+    {
+        float tnear = 0.0f, tfar = rays->closest[i];
+        const float o[3] = { rays->ox[i], rays->oy[i], rays->oz[i] };
+        const float inv[3] = { rays->ix[i], rays->iy[i], rays->iz[i] };
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            float t1 = (node->min[axis] - o[axis])*inv[axis];
+            float t2 = (node->max[axis] - o[axis])*inv[axis];
+            tnear = fmaxf(tnear, fminf(t1, t2));
+            tfar = fminf(tfar, fmaxf(t1, t2));
+        }
+
+        if (tnear <= tfar)
+        {
+            mask |= (1 << i);
+            if (tnear < *entry) *entry = tnear;
+        }
+    }
+#endif
+
+    return mask;
+}
+
+// Get ray collisions through mesh BVH, 4 rays at a time
+// NOTE: Rays are moved to mesh local space, so distances along them match world space ones,
+// returns false if transform can not be inverted
+static bool GetRayCollisionBVH(const Ray *rays, int rayCount, const MeshBVH *bvh, Matrix transform, RayCollision *collisions)
+{
+    #define EPSILON 0.000001f        // A small number, same as GetRayCollisionTriangle()
+
+    if (fabsf(MatrixDeterminant(transform)) < EPSILON*EPSILON) return false;
+
+    Matrix invTransform = MatrixInvert(transform);
+
+    for (int first = 0; first < rayCount; first += 4)
+    {
+        MeshBVHRays packet = { 0 };
+        int lanes = ((rayCount - first) < 4)? (rayCount - first) : 4;
+
+        for (int i = 0; i < 4; i++)
+        {
+            packet.closest[i] = -1.0f;
+            packet.triangle[i] = -1;
+            if (i >= lanes) continue;
+
+            Vector3 origin = Vector3Transform(rays[first + i].position, invTransform);
+            Vector3 direction = Vector3Subtract(Vector3Transform(Vector3Add(rays[first + i].position, rays[first + i].direction), invTransform), origin);
+
+            packet.ox[i] = origin.x; packet.oy[i] = origin.y; packet.oz[i] = origin.z;
+            packet.dx[i] = direction.x; packet.dy[i] = direction.y; packet.dz[i] = direction.z;
+
+            // Avoid infinity*0 in slab test for axis aligned rays
+            packet.ix[i] = 1.0f/((fabsf(direction.x) > 1e-20f)? direction.x : 1e-20f);
+            packet.iy[i] = 1.0f/((fabsf(direction.y) > 1e-20f)? direction.y : 1e-20f);
+            packet.iz[i] = 1.0f/((fabsf(direction.z) > 1e-20f)? direction.z : 1e-20f);
+            packet.closest[i] = FLT_MAX;
+        }
+
+        int stack[MESH_BVH_MAX_DEPTH + 2];
+        int stackSize = 0;
+        float entry = 0.0f;
+
+        if (GetRayPacketBoxHits(&packet, &bvh->nodes[0], &entry) != 0) stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const MeshBVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+            if (node->count > 0)
+            {
+                for (int t = node->start; t < node->start + node->count; t++)
+                {
+                    Vector3 p1 = bvh->triangles[t*3];
+                    Vector3 edge1 = Vector3Subtract(bvh->triangles[t*3 + 1], p1);
+                    Vector3 edge2 = Vector3Subtract(bvh->triangles[t*3 + 2], p1);
+
+                    for (int i = 0; i < lanes; i++)
+                    {
+                        // Moller-Trumbore, as GetRayCollisionTriangle()
+                        Vector3 direction = { packet.dx[i], packet.dy[i], packet.dz[i] };
+                        Vector3 p = Vector3CrossProduct(direction, edge2);
+                        float det = Vector3DotProduct(edge1, p);
+                        if ((det > -EPSILON) && (det < EPSILON)) continue;
+
+                        float invDet = 1.0f/det;
+                        Vector3 tv = { packet.ox[i] - p1.x, packet.oy[i] - p1.y, packet.oz[i] - p1.z };
+                        float u = Vector3DotProduct(tv, p)*invDet;
+                        if ((u < 0.0f) || (u > 1.0f)) continue;
+
+                        Vector3 q = Vector3CrossProduct(tv, edge1);
+                        float v = Vector3DotProduct(direction, q)*invDet;
+                        if ((v < 0.0f) || ((u + v) > 1.0f)) continue;
+
+                        float distance = Vector3DotProduct(edge2, q)*invDet;
+                        if ((distance > EPSILON) && (distance < packet.closest[i]))
+                        {
+                            packet.closest[i] = distance;
+                            packet.triangle[i] = t;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // Visit nearest child first, farther one is likely culled by then
+                float leftEntry = 0.0f, rightEntry = 0.0f;
+                bool leftHit = (GetRayPacketBoxHits(&packet, &bvh->nodes[node->start], &leftEntry) != 0);
+                bool rightHit = (GetRayPacketBoxHits(&packet, &bvh->nodes[node->start + 1], &rightEntry) != 0);
+
+                if (leftHit && rightHit)
+                {
+                    if (leftEntry <= rightEntry) { stack[stackSize++] = node->start + 1; stack[stackSize++] = node->start; }
+                    else { stack[stackSize++] = node->start; stack[stackSize++] = node->start + 1; }
+                }
+                else if (leftHit) stack[stackSize++] = node->start;
+                else if (rightHit) stack[stackSize++] = node->start + 1;
+            }
+        }
+
+        // Hit info in world space, same results as testing all triangles
+        for (int i = 0; i < lanes; i++)
+        {
+            RayCollision collision = { 0 };
+            int t = packet.triangle[i];
+
+            if (t >= 0)
+            {
+                Vector3 a = Vector3Transform(bvh->triangles[t*3], transform);
+                Vector3 b = Vector3Transform(bvh->triangles[t*3 + 1], transform);
+                Vector3 c = Vector3Transform(bvh->triangles[t*3 + 2], transform);
+
+                collision = GetRayCollisionTriangle(rays[first + i], a, b, c);
+
+                // Rounding differs between spaces, keep local space hit if world space test barely misses
+                if (!collision.hit)
+                {
+                    collision.hit = true;
+                    collision.distance = packet.closest[i];
+                    collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+                    collision.point = Vector3Add(rays[first + i].position, Vector3Scale(rays[first + i].direction, packet.closest[i]));
+                }
+            }
+
+            collisions[first + i] = collision;
+        }
+    }
+
+    return true;
+}
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
 //
@@ -115,11 +115,31 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_SDF_FONTS
+    #define MAX_SDF_FONTS                          8        // Maximum number of fonts loaded with LoadFontSDF() at the same time
+#endif
+#ifndef MAX_GLYPH_LOOKUP_FONTS
+    #define MAX_GLYPH_LOOKUP_FONTS                 8        // Maximum number of fonts with a cached glyph lookup table: GetGlyphIndex()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Codepoint to glyph index lookup for one font, built on first GetGlyphIndex() call
+// NOTE: Font is passed by value, so tables are kept in a small module cache keyed by the
+// font glyphs and recs arrays plus atlas texture, released by UnloadFont() and UnloadFontData()
+typedef struct GlyphLookup {
+    const GlyphInfo *glyphs;        // Font glyphs array the table was built from (cache key)
+    const Rectangle *recs;          // Font recs array the table was built from (cache key)
+    unsigned int textureId;         // Font atlas texture id the table was built from (cache key)
+    int glyphCount;                 // Font glyphs count the table was built from
+    int fallbackIndex;              // Index of fallback glyph '?'
+    int *pages[256];                // Basic Multilingual Plane: 256 pages of 256 glyph indices, -1 or NULL page if missing
+    int *hashCodepoints;            // Codepoints beyond the BMP, open addressing hash table (0 is an empty slot)
+    int *hashIndices;               // Glyph indices for hashCodepoints
+    int hashCapacity;               // Hash table capacity, power of two (0 if no codepoints beyond the BMP)
+    unsigned int lastUse;           // Lookup counter on last use, least recently used table is replaced
+} GlyphLookup;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -131,6 +151,12 @@ extern bool isGpuReady;
 static Font defaultFont = { 0 };
 #endif
 
+static unsigned int sdfFontTextures[MAX_SDF_FONTS] = { 0 };      // Atlas texture ids of fonts loaded with LoadFontSDF()
+static Shader sdfShader = { 0 };                                    // Built-in SDF font shader, loaded on first use
+
+static GlyphLookup glyphLookups[MAX_GLYPH_LOOKUP_FONTS] = { 0 };   // Glyph lookup tables for recently used fonts
+static unsigned int glyphLookupCounter = 0;                        // Lookup tables use counter
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -147,6 +173,13 @@ static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, i
 #endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
+static bool BeginFontShader(Font font);                     // Enable built-in SDF shader if font is SDF and no other shader is active
+static void EndFontShader(bool enabled);                    // Disable built-in SDF shader if BeginFontShader() enabled it
+
+static GlyphLookup *GetGlyphLookup(Font font);              // Get (or build) glyph lookup table for a font
+static bool IsGlyphLookupForFont(const GlyphLookup *lookup, Font font); // Check if a glyph lookup table was built from a font
+static void UnloadGlyphLookup(const GlyphInfo *glyphs);     // Unload glyph lookup table built from a glyphs array
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
@@ -310,6 +343,11 @@ extern void UnloadFontDefault(void)
 {
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
     if (isGpuReady) UnloadTexture(defaultFont.texture);
+    UnloadGlyphLookup(defaultFont.glyphs);
+
+    // Built-in SDF font shader is unloaded with the default font, both live until CloseWindow()
+    if (sdfShader.id > 0) UnloadShader(sdfShader);
+    sdfShader = (Shader){ 0 };
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
 }
@@ -581,6 +619,143 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from file as a signed distance field atlas
+// NOTE: One atlas at fontSize serves any drawing size, text drawing functions
+// draw SDF fonts with a built-in shader, glyph edges stay sharp when scaled up
+Font LoadFontSDF(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        font.baseSize = fontSize;
+        font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+        font.glyphPadding = 0;      // SDF glyph images already include FONT_SDF_CHAR_PADDING
+        font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, FONT_SDF);
+
+        UnloadFileData(fileData);
+    }
+
+    if (font.glyphs != NULL)
+    {
+        Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+        if (isGpuReady)
+        {
+            font.texture = LoadTextureFromImage(atlas);
+            SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);    // Distance is interpolated between texels
+        }
+        UnloadImage(atlas);
+
+        int slot = -1;
+        for (int i = 0; i < MAX_SDF_FONTS; i++)
+        {
+            if (sdfFontTextures[i] == 0) { slot = i; break; }
+        }
+
+        if ((slot >= 0) && (font.texture.id > 0)) sdfFontTextures[slot] = font.texture.id;
+        else if (font.texture.id > 0) TRACELOG(LOG_WARNING, "FONT: [%s] Maximum SDF fonts reached (%i), font drawn without SDF shader", fileName, MAX_SDF_FONTS);
+
+        TRACELOG(LOG_INFO, "FONT: [%s] SDF data loaded successfully (%i pixel size | %i glyphs)", fileName, font.baseSize, font.glyphCount);
+    }
+    else font = GetFontDefault();
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Check if a font was loaded as a signed distance field atlas with LoadFontSDF()
+bool IsFontSDF(Font font)
+{
+    if (font.texture.id == 0) return false;
+
+    for (int i = 0; i < MAX_SDF_FONTS; i++)
+    {
+        if (sdfFontTextures[i] == font.texture.id) return true;
+    }
+
+    return false;
+}
+
+// Get built-in shader for SDF fonts, loaded on first use
+// NOTE: Uses the default vertex shader, alpha is smoothed over one screen pixel of distance
+Shader GetFontShaderSDF(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((sdfShader.id == 0) && isGpuReady)
+    {
+        const char *sdfShaderCode =
+    #if defined(GRAPHICS_API_OPENGL_ES3)
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "out vec4 finalColor;\n"
+        "#define texture2D texture\n"
+    #elif defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "precision mediump float;\n"
+        "varying vec2 fragTexCoord;\n"
+        "varying vec4 fragColor;\n"
+        "#define finalColor gl_FragColor\n"
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        "#version 330\n"
+        "in vec2 fragTexCoord;\n"
+        "in vec4 fragColor;\n"
+        "out vec4 finalColor;\n"
+        "#define texture2D texture\n"
+    #else
+        "#version 120\n"
+        "varying vec2 fragTexCoord;\n"
+        "varying vec4 fragColor;\n"
+        "#define finalColor gl_FragColor\n"
+    #endif
+        "uniform sampler2D texture0;\n"
+        "uniform vec4 colDiffuse;\n"
+        "void main()\n"
+        "{\n"
+        "    float distance = texture2D(texture0, fragTexCoord).a - 0.5;\n"
+        "    float smoothing = length(vec2(dFdx(distance), dFdy(distance)));\n"
+        "    float alpha = smoothstep(-smoothing, smoothing, distance);\n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;\n"
+        "}\n";
+
+        sdfShader = LoadShaderFromMemory(NULL, sdfShaderCode);
+    }
+#endif
+
+    return sdfShader;
+}
+
+// Enable built-in SDF shader for an SDF font, only when no other shader is active:
+// a shader set by the user with BeginShaderMode() or by an outer text drawing call is kept
+// NOTE: Shader switch flushes the render batch, it is done once per text draw, not per glyph
+static bool BeginFontShader(Font font)
+{
+    if (!IsFontSDF(font) || (rlGetShaderIdActive() != rlGetShaderIdDefault())) return false;
+
+    Shader shader = GetFontShaderSDF();
+    if (shader.id == 0) return false;
+
+    BeginShaderMode(shader);
+
+    return true;
+}
+
+// Disable built-in SDF shader, only if enabled by the matching BeginFontShader()
+static void EndFontShader(bool enabled)
+{
+    if (!enabled) return;
+
+    EndShaderMode();
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool IsFontValid(Font font)
@@ -940,6 +1115,7 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
     {
         for (int i = 0; i < glyphCount; i++) UnloadImage(glyphs[i].image);
 
+        UnloadGlyphLookup(glyphs);
         RL_FREE(glyphs);
     }
 }
@@ -947,9 +1123,18 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
+    // Glyph lookup table is dropped even if font data is not owned here, the glyphs array
+    // address can be reused by the next font loaded
+    UnloadGlyphLookup(font.glyphs);
+
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
+        for (int i = 0; i < MAX_SDF_FONTS; i++)
+        {
+            if (sdfFontTextures[i] == font.texture.id) sdfFontTextures[i] = 0;
+        }
+
         UnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) UnloadTexture(font.texture);
         RL_FREE(font.recs);
@@ -1156,6 +1341,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool sdfShaderEnabled = BeginFontShader(font);
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1182,6 +1369,8 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    EndFontShader(sdfShaderEnabled);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1219,7 +1408,9 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
+    bool sdfShaderEnabled = BeginFontShader(font);
     DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    EndFontShader(sdfShaderEnabled);
 }
 
 // Draw multiple character (codepoints)
@@ -1230,6 +1421,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool sdfShaderEnabled = BeginFontShader(font);
+
     for (int i = 0; i < codepointCount; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1251,6 +1444,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    EndFontShader(sdfShaderEnabled);
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1336,27 +1531,37 @@ Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing
 
 // Get index position for a unicode character on font
 // NOTE: If codepoint is not found in the font it fallbacks to '?'
+// NOTE: Lookup goes through a table built on first use, so its cost does not depend on the glyph count
 int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
-    int fallbackIndex = 0;      // Get index of fallback glyph '?'
+    if ((font.glyphs == NULL) || (font.glyphCount <= 0)) return 0;
 
-    // Look for character index in the unordered charset
-    for (int i = 0; i < font.glyphCount; i++)
-    {
-        if (font.glyphs[i].value == 63) fallbackIndex = i;
+    GlyphLookup *lookup = GetGlyphLookup(font);
+    index = -1;
 
-        if (font.glyphs[i].value == codepoint)
+    if ((codepoint >= 0) && (codepoint <= 0xffff))
+    {
+        int *page = lookup->pages[codepoint >> 8];
+        if (page != NULL) index = page[codepoint & 0xff];
+    }
+    else if ((codepoint > 0xffff) && (lookup->hashCapacity > 0))
+    {
+        unsigned int mask = lookup->hashCapacity - 1;
+        for (unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask; lookup->hashCodepoints[slot] != 0; slot = (slot + 1) & mask)
         {
-            index = i;
-            break;
+            if (lookup->hashCodepoints[slot] == codepoint)
+            {
+                index = lookup->hashIndices[slot];
+                break;
+            }
         }
     }
 
-    if ((index == 0) && (font.glyphs[0].value != codepoint)) index = fallbackIndex;
+    if (index < 0) index = lookup->fallbackIndex;
 #else
     index = codepoint - 32;
 #endif
@@ -1364,6 +1569,118 @@ int GetGlyphIndex(Font font, int codepoint)
     return index;
 }
 
+// Get glyph lookup table for a font, building it if the font was not looked up recently
+// NOTE: First glyph wins for repeated codepoints and the last '?' glyph is the fallback,
+// same results as a linear scan over the unordered charset
+static GlyphLookup *GetGlyphLookup(Font font)
+{
+    static GlyphLookup *lastLookup = NULL;      // Most text draws use the same font repeatedly
+
+    glyphLookupCounter++;
+    if ((lastLookup != NULL) && IsGlyphLookupForFont(lastLookup, font))
+    {
+        lastLookup->lastUse = glyphLookupCounter;
+        return lastLookup;
+    }
+
+    GlyphLookup *lookup = &glyphLookups[0];
+    for (int i = 0; i < MAX_GLYPH_LOOKUP_FONTS; i++)
+    {
+        if (IsGlyphLookupForFont(&glyphLookups[i], font))
+        {
+            lastLookup = &glyphLookups[i];
+            lastLookup->lastUse = glyphLookupCounter;
+            return lastLookup;
+        }
+
+        if (glyphLookups[i].lastUse < lookup->lastUse) lookup = &glyphLookups[i];
+    }
+
+    // Replace the least recently used table (empty tables have lastUse 0)
+    UnloadGlyphLookup(lookup->glyphs);
+
+    lookup->glyphs = font.glyphs;
+    lookup->recs = font.recs;
+    lookup->textureId = font.texture.id;
+    lookup->glyphCount = font.glyphCount;
+    lookup->lastUse = glyphLookupCounter;
+
+    int outsideCount = 0;
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        int value = font.glyphs[i].value;
+        if (value == 63) lookup->fallbackIndex = i;
+
+        if ((value >= 0) && (value <= 0xffff))
+        {
+            int **page = &lookup->pages[value >> 8];
+            if (*page == NULL)
+            {
+                *page = (int *)RL_MALLOC(256*sizeof(int));
+                for (int k = 0; k < 256; k++) (*page)[k] = -1;
+            }
+            if ((*page)[value & 0xff] < 0) (*page)[value & 0xff] = i;
+        }
+        else if (value > 0xffff) outsideCount++;
+    }
+
+    if (outsideCount > 0)
+    {
+        // Keep the hash table at most half full
+        lookup->hashCapacity = 16;
+        while (lookup->hashCapacity < outsideCount*2) lookup->hashCapacity *= 2;
+        lookup->hashCodepoints = (int *)RL_CALLOC(lookup->hashCapacity, sizeof(int));
+        lookup->hashIndices = (int *)RL_CALLOC(lookup->hashCapacity, sizeof(int));
+
+        unsigned int mask = lookup->hashCapacity - 1;
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            int value = font.glyphs[i].value;
+            if (value <= 0xffff) continue;
+
+            unsigned int slot = ((unsigned int)value*2654435761u) & mask;
+            while ((lookup->hashCodepoints[slot] != 0) && (lookup->hashCodepoints[slot] != value)) slot = (slot + 1) & mask;
+            if (lookup->hashCodepoints[slot] == 0)
+            {
+                lookup->hashCodepoints[slot] = value;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    lastLookup = lookup;
+
+    return lookup;
+}
+
+// Check if a glyph lookup table was built from a font
+// NOTE: A freed glyphs array can be reused by the next allocation, recs and texture make a match
+// with a different font less likely if glyphs were freed outside UnloadFont()/UnloadFontData()
+static bool IsGlyphLookupForFont(const GlyphLookup *lookup, Font font)
+{
+    return ((lookup->glyphs == font.glyphs) && (lookup->recs == font.recs) &&
+            (lookup->textureId == font.texture.id) && (lookup->glyphCount == font.glyphCount));
+}
+
+// Unload glyph lookup table built from a glyphs array, if any
+static void UnloadGlyphLookup(const GlyphInfo *glyphs)
+{
+    if (glyphs == NULL) return;
+
+    for (int i = 0; i < MAX_GLYPH_LOOKUP_FONTS; i++)
+    {
+        GlyphLookup *lookup = &glyphLookups[i];
+        if (lookup->glyphs != glyphs) continue;
+
+        for (int p = 0; p < 256; p++) RL_FREE(lookup->pages[p]);
+        RL_FREE(lookup->hashCodepoints);
+        RL_FREE(lookup->hashIndices);
+
+        GlyphLookup empty = { 0 };
+        *lookup = empty;
+    }
+}
+
 // Get glyph font info data for a codepoint (unicode character)
 // NOTE: If codepoint is not found in the font it fallbacks to '?'
 GlyphInfo GetGlyphInfo(Font font, int codepoint)
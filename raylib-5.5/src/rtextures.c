@@ -225,6 +225,43 @@
     #pragma GCC diagnostic pop
 #endif
 
+// SSE2 is the baseline for image color kernels, AVX2 variants are selected at runtime
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RTEXTURES_SSE2
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in ImageColor*(), ImageFormat(), ImageDraw()]
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define RTEXTURES_AVX2
+        #define RTEXTURES_AVX2_TARGET
+        #include <intrin.h>     // Required for: __cpuid(), __cpuidex(), _xgetbv() [Used in GetImageSimdLevel()]
+        #include <immintrin.h>  // Required for: AVX2 intrinsics
+    #elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        #define RTEXTURES_AVX2
+        #define RTEXTURES_AVX2_TARGET __attribute__((target("avx2")))
+        #include <immintrin.h>  // Required for: AVX2 intrinsics
+    #endif
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION_THREADS) || defined(SUPPORT_IMAGE_LOADING_THREADS)
+    #define RTEXTURES_THREADS
+#endif
+
+#if defined(RTEXTURES_THREADS)
+    #if defined(_WIN32)
+__declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join() [Used in GenImagePerlinNoise(), GenImageCellular(), LoadImages()]
+        #include <unistd.h>     // Required for: sysconf() [Used in LoadImages()]
+    #endif
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>         // Required for: _InterlockedExchangeAdd() [Used in LoadImages()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -236,10 +273,68 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_GENERATION_MAX_THREADS
+    #define IMAGE_GENERATION_MAX_THREADS    8   // Maximum threads used to generate one image
+#endif
+#ifndef IMAGE_GENERATION_TILE_ROWS
+    #define IMAGE_GENERATION_TILE_ROWS     64   // Image rows per generation tile
+#endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH          4096   // Maximum length for filepaths, used for .qoi lookup in LoadImages()
+#endif
+#ifndef IMAGE_LOADING_MAX_THREADS
+    #define IMAGE_LOADING_MAX_THREADS       8   // Maximum threads used to decode a batch of images
+#endif
+
+// Maximum workers run at once by any image function
+#define IMAGE_MAX_WORKERS   ((IMAGE_GENERATION_MAX_THREADS > IMAGE_LOADING_MAX_THREADS)? IMAGE_GENERATION_MAX_THREADS : IMAGE_LOADING_MAX_THREADS)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image worker, runs a job on the calling thread or a worker thread
+typedef struct ImageWorker {
+    void (*run)(void *job);     // Job function
+    void *job;                  // Job data
+} ImageWorker;
+
+// Image batch loading job, shared by all workers, each one takes the next file until done
+typedef struct ImageBatchJob {
+    const char **fileNames;     // Files to load
+    Image *images;              // Loaded images, one per file
+    int count;                  // Number of files
+    volatile long next;         // Next file index
+} ImageBatchJob;
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Image generation job, processes row tiles first, first + step, first + 2*step...
+typedef struct ImageTileJob {
+    void (*process)(const void *params, Color *pixels, int startY, int endY);  // Tile rows generator
+    const void *params;         // Generator parameters, shared by all jobs
+    Color *pixels;              // Image pixels, tiles never overlap
+    int height;                 // Image height
+    int first;                  // First tile index
+    int step;                   // Tile index step (number of jobs)
+} ImageTileJob;
+
+// Perlin noise generation parameters
+typedef struct PerlinNoiseParams {
+    int width;
+    int height;
+    int offsetX;
+    int offsetY;
+    float scale;
+} PerlinNoiseParams;
+
+// Cellular generation parameters
+typedef struct CellularParams {
+    int width;
+    int tileSize;
+    int seedsPerRow;
+    int seedsPerCol;
+    const int *seeds;           // Seed positions, x and y per seed
+} CellularParams;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -258,6 +353,35 @@ static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
 
+static int GetImageSimdLevel(void);                         // Get SIMD level available at runtime: 0-scalar, 1-SSE2, 2-AVX2
+static void TintPixelsRGBA8(unsigned char *pixels, int count, Color color);              // Tint RGBA8 pixels in place
+static void InvertPixelsRGBA8(unsigned char *pixels, int count);                         // Invert RGB of RGBA8 pixels in place
+static void ContrastPixelsRGBA8(unsigned char *pixels, int count, float contrast);       // Apply contrast factor to RGBA8 pixels in place
+static void BrightnessPixelsRGBA8(unsigned char *pixels, int count, int brightness);     // Apply brightness offset to RGBA8 pixels in place
+static void ReplacePixelsRGBA8(unsigned char *pixels, int count, Color color, Color replace); // Replace matching RGBA8 pixels in place
+static void GrayscalePixelsRGBA8(const unsigned char *src, unsigned char *dst, int count);   // Convert RGBA8 pixels to grayscale (dst can alias src)
+static void BlendPixelsRGBA8(unsigned char *dst, const unsigned char *src, int count, Color tint); // Alpha blend tinted RGBA8 row over RGBA8 row
+static bool ImageFormatDirect(Image *image, int newFormat);  // Convert between 8bit per channel formats in place, false if not supported
+static bool IsGrayscaleLookupRequired(const Image *image);   // Check if a grayscale image color op should go through a lookup table
+static Image GenImageGrayscaleRamp(void);                    // Generate 256x1 grayscale image with values 0..255, used as lookup table
+static void ImageApplyGrayscaleLookup(Image *image, Image lookup); // Map grayscale image values through lookup image (unloaded)
+
+static void GetDXT1Palette(unsigned short c0, unsigned short c1, bool fourColors, unsigned char palette[4][4]); // Get DXT1 block palette from 565 endpoints
+static void GetDXT5AlphaPalette(unsigned char a0, unsigned char a1, unsigned char palette[8]);  // Get DXT5 block alpha palette from endpoints
+static void EncodeDXT1Block(const unsigned char block[16][4], bool punchThrough, unsigned char *output);  // Encode 4x4 RGBA8 block to 8 bytes DXT1 color
+static void EncodeDXT5AlphaBlock(const unsigned char block[16][4], unsigned char *output);  // Encode 4x4 RGBA8 block alpha to 8 bytes DXT5 alpha
+static void ImageCompressDXT(Image *image, int format);      // Encode RGBA8 image (all mipmaps) to DXT1 or DXT5
+static void ImageDecompressDXT(Image *image);                // Decode DXT1/DXT3/DXT5 image (all mipmaps) to RGBA8
+
+static void RunImageWorkers(ImageWorker *workers, int count);  // Run workers, first one on calling thread and the others on worker threads if supported
+static void LoadImageBatchFiles(void *job);                  // Load images from a batch job until no files are left
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void RunImageTileJobs(void (*process)(const void *, Color *, int, int), const void *params, Color *pixels, int height); // Generate image row tiles, on worker threads if supported
+static void GenPerlinNoiseRows(const void *params, Color *pixels, int startY, int endY);    // Generate perlin noise image rows
+static void GenCellularRows(const void *params, Color *pixels, int startY, int endY);       // Generate cellular image rows
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -295,6 +419,43 @@ Image LoadImage(const char *fileName)
     return image;
 }
 
+// Load multiple images from files, decoded in parallel on worker threads if supported
+// NOTE: images must have room for count images, files failing to load are left empty (data = NULL)
+// NOTE: A .qoi file with the same name is preferred over the requested file when it is at least as new
+int LoadImages(const char **fileNames, int count, Image *images)
+{
+    if ((fileNames == NULL) || (images == NULL) || (count <= 0)) return 0;
+
+    for (int i = 0; i < count; i++) images[i] = (Image){ 0 };
+
+    int workerCount = 1;
+#if defined(SUPPORT_IMAGE_LOADING_THREADS)
+    #if defined(_WIN32)
+    workerCount = (int)GetActiveProcessorCount(0xFFFF);     // ALL_PROCESSOR_GROUPS
+    #else
+    workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+    if (workerCount > IMAGE_LOADING_MAX_THREADS) workerCount = IMAGE_LOADING_MAX_THREADS;
+    if (workerCount > count) workerCount = count;
+    if (workerCount < 1) workerCount = 1;
+#endif
+
+    // All workers share the job, taking the next file as soon as they are done with one,
+    // so a few large images don't leave the other threads idle
+    ImageBatchJob job = { fileNames, images, count, 0 };
+    ImageWorker workers[IMAGE_LOADING_MAX_THREADS] = { 0 };
+    for (int j = 0; j < workerCount; j++) workers[j] = (ImageWorker){ LoadImageBatchFiles, &job };
+
+    RunImageWorkers(workers, workerCount);
+
+    int loaded = 0;
+    for (int i = 0; i < count; i++) if (images[i].data != NULL) loaded++;
+
+    TRACELOG(LOG_INFO, "IMAGE: Batch loaded %i/%i images [%i workers]", loaded, count, workerCount);
+
+    return loaded;
+}
+
 // Load an image from RAW file data
 Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize)
 {
@@ -1007,39 +1168,9 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    float aspectRatio = (float)width / (float)height;
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
-
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    // Image is generated in row tiles, see GenPerlinNoiseRows()
+    PerlinNoiseParams params = { width, height, offsetX, offsetY, scale };
+    RunImageTileJobs(GenPerlinNoiseRows, &params, pixels, height);
 
     Image image = {
         .data = pixels,
@@ -1061,48 +1192,18 @@ Image GenImageCellular(int width, int height, int tileSize)
     int seedsPerCol = height/tileSize;
     int seedCount = seedsPerRow*seedsPerCol;
 
-    Vector2 *seeds = (Vector2 *)RL_MALLOC(seedCount*sizeof(Vector2));
+    int *seeds = (int *)RL_MALLOC(seedCount*2*sizeof(int));
 
+    // NOTE: Seeds are placed on calling thread, GetRandomValue() sequence is kept
     for (int i = 0; i < seedCount; i++)
     {
-        int y = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        int x = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
-        seeds[i] = (Vector2){ (float)x, (float)y };
+        seeds[i*2 + 1] = (i/seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
+        seeds[i*2] = (i%seedsPerRow)*tileSize + GetRandomValue(0, tileSize - 1);
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    // Image is generated in row tiles, see GenCellularRows()
+    CellularParams params = { width, tileSize, seedsPerRow, seedsPerCol, seeds };
+    RunImageTileJobs(GenCellularRows, &params, pixels, height);
 
     RL_FREE(seeds);
 
@@ -1258,6 +1359,25 @@ void ImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
+        // DXT compressed data is decoded to RGBA8 (all mipmaps kept) and converted from there if required
+        if ((image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image->format <= PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            ImageDecompressDXT(image);
+            if (image->format == newFormat) return;
+        }
+
+        // Uncompressed data is encoded to DXT1/DXT5 from RGBA8, every mipmap level is encoded
+        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+            ((newFormat == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (newFormat == PIXELFORMAT_COMPRESSED_DXT1_RGBA) || (newFormat == PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+        {
+            ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            ImageCompressDXT(image, newFormat);
+            return;
+        }
+
+        // Fast path: Common 8bit per channel conversions done in place, no normalized float copy
+        if ((image->mipmaps == 1) && ImageFormatDirect(image, newFormat)) return;
+
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
@@ -2747,6 +2867,22 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Fast path: RGBA8 pixels modified in place, no intermediate copy
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps == 1))
+    {
+        TintPixelsRGBA8((unsigned char *)image->data, image->width*image->height, color);
+        return;
+    }
+
+    // Fast path: Grayscale pixels mapped through the same op applied to a 256 values ramp
+    if (IsGrayscaleLookupRequired(image))
+    {
+        Image lookup = GenImageGrayscaleRamp();
+        ImageColorTint(&lookup, color);
+        ImageApplyGrayscaleLookup(image, lookup);
+        return;
+    }
+
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2777,6 +2913,22 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Fast path: RGBA8 pixels modified in place, no intermediate copy
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps == 1))
+    {
+        InvertPixelsRGBA8((unsigned char *)image->data, image->width*image->height);
+        return;
+    }
+
+    // Fast path: Grayscale pixels mapped through the same op applied to a 256 values ramp
+    if (IsGrayscaleLookupRequired(image))
+    {
+        Image lookup = GenImageGrayscaleRamp();
+        ImageColorInvert(&lookup);
+        ImageApplyGrayscaleLookup(image, lookup);
+        return;
+    }
+
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2808,12 +2960,28 @@ void ImageColorContrast(Image *image, float contrast)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Fast path: Grayscale pixels mapped through the same op applied to a 256 values ramp
+    if (IsGrayscaleLookupRequired(image))
+    {
+        Image lookup = GenImageGrayscaleRamp();
+        ImageColorContrast(&lookup, contrast);
+        ImageApplyGrayscaleLookup(image, lookup);
+        return;
+    }
+
     if (contrast < -100) contrast = -100;
     if (contrast > 100) contrast = 100;
 
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
+    // Fast path: RGBA8 pixels modified in place, no intermediate copy
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps == 1))
+    {
+        ContrastPixelsRGBA8((unsigned char *)image->data, image->width*image->height, contrast);
+        return;
+    }
+
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2866,6 +3034,22 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
+    // Fast path: RGBA8 pixels modified in place, no intermediate copy
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps == 1))
+    {
+        BrightnessPixelsRGBA8((unsigned char *)image->data, image->width*image->height, brightness);
+        return;
+    }
+
+    // Fast path: Grayscale pixels mapped through the same op applied to a 256 values ramp
+    if (IsGrayscaleLookupRequired(image))
+    {
+        Image lookup = GenImageGrayscaleRamp();
+        ImageColorBrightness(&lookup, brightness);
+        ImageApplyGrayscaleLookup(image, lookup);
+        return;
+    }
+
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2903,6 +3087,22 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Fast path: RGBA8 pixels modified in place, no intermediate copy
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps == 1))
+    {
+        ReplacePixelsRGBA8((unsigned char *)image->data, image->width*image->height, color, replace);
+        return;
+    }
+
+    // Fast path: Grayscale pixels mapped through the same op applied to a 256 values ramp
+    if (IsGrayscaleLookupRequired(image))
+    {
+        Image lookup = GenImageGrayscaleRamp();
+        ImageColorReplace(&lookup, color, replace);
+        ImageApplyGrayscaleLookup(image, lookup);
+        return;
+    }
+
     Color *pixels = LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -4010,6 +4210,11 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            // Fast path: RGBA8 over RGBA8 blended a full row at a time, no per-pixel format dispatch
+            else if (blendRequired && (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+            {
+                BlendPixelsRGBA8(pDst, pSrc, (int)srcRec.width, tint);
+            }
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -4119,6 +4324,19 @@ Texture2D LoadTextureFromImage(Image image)
 
     if ((image.width != 0) && (image.height != 0))
     {
+        // GPU without support for a DXT format: data is decoded on CPU and loaded as RGBA8
+        if ((image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.format <= PIXELFORMAT_COMPRESSED_DXT5_RGBA) && !rlIsPixelFormatSupported(image.format))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported by GPU, decoding to RGBA8");
+
+            Image decoded = ImageCopy(image);
+            ImageFormat(&decoded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            texture = LoadTextureFromImage(decoded);
+            UnloadImage(decoded);
+
+            return texture;
+        }
+
         texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
@@ -4540,34 +4758,50 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+        if (rlIsSpriteQueueActive())
+        {
+            // Deferred, the quad gets sorted by texture with the rest of the queue
+            float left = (flipX? (source.x + source.width) : source.x)/width;
+            float right = (flipX? source.x : (source.x + source.width))/width;
+            float top = source.y/height;
+            float bottom = (source.y + source.height)/height;
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+            float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+            float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
+            rlQueueSprite(texture.id, vertices, texcoords, tint.r, tint.g, tint.b, tint.a);
+        }
+        else
+        {
+            rlSetTexture(texture.id);
+            rlBegin(RL_QUADS);
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(topLeft.x, topLeft.y);
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(bottomLeft.x, bottomLeft.y);
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(bottomRight.x, bottomRight.y);
 
-        rlEnd();
-        rlSetTexture(0);
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(topRight.x, topRight.y);
+
+            rlEnd();
+            rlSetTexture(0);
+        }
 
         // NOTE: Vertex position can be transformed using matrices
         // but the process is way more costly than just calculating
@@ -5364,13 +5598,14 @@ int GetPixelDataSize(int width, int height, int format)
     double bytesPerPixel = (double)bpp/8.0;
     dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks (ASTC 8x8 on 8x8 blocks),
+    // partial blocks on the edges take a full block of 8 or 16 bytes
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGBA))
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        int blockSize = (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)? 8 : 4;
+        dataSize = ((width + blockSize - 1)/blockSize)*((height + blockSize - 1)/blockSize)*(bpp*blockSize*blockSize/8);
     }
+    else if ((format >= PIXELFORMAT_COMPRESSED_PVRT_RGB) && (width < 4) && (height < 4)) dataSize = 16;
 
     return dataSize;
 }
@@ -5545,4 +5780,1288 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+
+// Get SIMD level available at runtime: 0-scalar, 1-SSE2, 2-AVX2
+// NOTE: Detection runs once, concurrent first calls just store the same value
+static int GetImageSimdLevel(void)
+{
+    static int level = -1;
+
+    if (level < 0)
+    {
+        int detected = 0;
+    #if defined(RTEXTURES_SSE2)
+        detected = 1;
+        #if defined(RTEXTURES_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        bool osxsave = ((info[2] & (1 << 27)) != 0);
+        bool avx = ((info[2] & (1 << 28)) != 0);
+        if (osxsave && avx && ((_xgetbv(0) & 6) == 6))
+        {
+            __cpuidex(info, 7, 0);
+            if ((info[1] & (1 << 5)) != 0) detected = 2;
+        }
+        #elif defined(RTEXTURES_AVX2)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) detected = 2;
+        #endif
+    #endif
+        level = detected;
+    }
+
+    return level;
+}
+
+#if defined(RTEXTURES_SSE2)
+// Divide 16bit lanes by 255, exact for values up to 255*255: x/255 = (x + 1 + (x >> 8)) >> 8
+static inline __m128i DivideBy255Sse2(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+#endif
+
+#if defined(RTEXTURES_AVX2)
+RTEXTURES_AVX2_TARGET static void TintPixelsRGBA8Avx2(unsigned char *pixels, int count, Color color)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi16(1);
+    __m256i tint = _mm256_set_epi16(color.a, color.b, color.g, color.r, color.a, color.b, color.g, color.r,
+                                    color.a, color.b, color.g, color.r, color.a, color.b, color.g, color.r);
+
+    for (int i = 0; i < count/8*8; i += 8)
+    {
+        __m256i p = _mm256_loadu_si256((__m256i *)(pixels + i*4));
+        __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(p, zero), tint);
+        __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(p, zero), tint);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(lo, one), _mm256_srli_epi16(lo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(hi, one), _mm256_srli_epi16(hi, 8)), 8);
+        _mm256_storeu_si256((__m256i *)(pixels + i*4), _mm256_packus_epi16(lo, hi));
+    }
+}
+
+RTEXTURES_AVX2_TARGET static void InvertPixelsRGBA8Avx2(unsigned char *pixels, int count)
+{
+    __m256i mask = _mm256_set1_epi32(0x00ffffff);
+
+    for (int i = 0; i < count/8*8; i += 8)
+    {
+        __m256i p = _mm256_loadu_si256((__m256i *)(pixels + i*4));
+        _mm256_storeu_si256((__m256i *)(pixels + i*4), _mm256_xor_si256(p, mask));
+    }
+}
+
+RTEXTURES_AVX2_TARGET static void BrightnessPixelsRGBA8Avx2(unsigned char *pixels, int count, int brightness)
+{
+    __m256i offset = _mm256_set1_epi32(((brightness < 0)? -brightness : brightness)*0x010101);
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi8(1);
+
+    for (int i = 0; i < count/8*8; i += 8)
+    {
+        __m256i p = _mm256_loadu_si256((__m256i *)(pixels + i*4));
+
+        if (brightness >= 0) p = _mm256_adds_epu8(p, offset);
+        else
+        {
+            // Values going below 0 are set to 1
+            __m256i under = _mm256_cmpeq_epi8(_mm256_subs_epu8(offset, p), zero);
+            p = _mm256_or_si256(_mm256_subs_epu8(p, offset), _mm256_andnot_si256(under, one));
+        }
+
+        _mm256_storeu_si256((__m256i *)(pixels + i*4), p);
+    }
+}
+
+RTEXTURES_AVX2_TARGET static void ReplacePixelsRGBA8Avx2(unsigned char *pixels, int count, Color color, Color replace)
+{
+    unsigned int col = 0, rep = 0;
+    memcpy(&col, &color, 4);
+    memcpy(&rep, &replace, 4);
+    __m256i vcol = _mm256_set1_epi32((int)col);
+    __m256i vrep = _mm256_set1_epi32((int)rep);
+
+    for (int i = 0; i < count/8*8; i += 8)
+    {
+        __m256i p = _mm256_loadu_si256((__m256i *)(pixels + i*4));
+        __m256i match = _mm256_cmpeq_epi32(p, vcol);
+        _mm256_storeu_si256((__m256i *)(pixels + i*4), _mm256_blendv_epi8(p, vrep, match));
+    }
+}
+#endif
+
+// Tint RGBA8 pixels in place
+// NOTE: Same result as (c*tint)/255 per channel
+static void TintPixelsRGBA8(unsigned char *pixels, int count, Color color)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_AVX2)
+    if (GetImageSimdLevel() >= 2)
+    {
+        TintPixelsRGBA8Avx2(pixels, count, color);
+        i = count/8*8;
+    }
+#endif
+#if defined(RTEXTURES_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    __m128i tint = _mm_set_epi16(color.a, color.b, color.g, color.r, color.a, color.b, color.g, color.r);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((__m128i *)(pixels + i*4));
+        __m128i lo = DivideBy255Sse2(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), tint));
+        __m128i hi = DivideBy255Sse2(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), tint));
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned char *p = pixels + i*4;
+        p[0] = (unsigned char)(((int)p[0]*(int)color.r)/255);
+        p[1] = (unsigned char)(((int)p[1]*(int)color.g)/255);
+        p[2] = (unsigned char)(((int)p[2]*(int)color.b)/255);
+        p[3] = (unsigned char)(((int)p[3]*(int)color.a)/255);
+    }
+}
+
+// Invert RGB of RGBA8 pixels in place, alpha is kept
+static void InvertPixelsRGBA8(unsigned char *pixels, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_AVX2)
+    if (GetImageSimdLevel() >= 2)
+    {
+        InvertPixelsRGBA8Avx2(pixels, count);
+        i = count/8*8;
+    }
+#endif
+#if defined(RTEXTURES_SSE2)
+    __m128i mask = _mm_set1_epi32(0x00ffffff);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((__m128i *)(pixels + i*4));
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_xor_si128(p, mask));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned char *p = pixels + i*4;
+        p[0] = 255 - p[0];
+        p[1] = 255 - p[1];
+        p[2] = 255 - p[2];
+    }
+}
+
+// Apply contrast factor to RGBA8 pixels in place, alpha is kept
+// NOTE: Float operations follow the same order as the scalar code, results are identical
+static void ContrastPixelsRGBA8(unsigned char *pixels, int count, float contrast)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    __m128 scale = _mm_set1_ps(255.0f);
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128 factor = _mm_set1_ps(contrast);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((__m128i *)(pixels + i*4));
+        __m128i lo = _mm_unpacklo_epi8(p, zero);
+        __m128i hi = _mm_unpackhi_epi8(p, zero);
+        __m128i channels[4] = { _mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero), _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero) };
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128 c = _mm_div_ps(_mm_cvtepi32_ps(channels[k]), scale);
+            c = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(c, half), factor), half), scale);
+            c = _mm_min_ps(_mm_max_ps(c, _mm_setzero_ps()), scale);
+            channels[k] = _mm_cvttps_epi32(c);
+        }
+
+        __m128i result = _mm_packus_epi16(_mm_packs_epi32(channels[0], channels[1]), _mm_packs_epi32(channels[2], channels[3]));
+        result = _mm_or_si128(_mm_andnot_si128(alphaMask, result), _mm_and_si128(alphaMask, p));
+        _mm_storeu_si128((__m128i *)(pixels + i*4), result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            float c = (float)pixels[i*4 + k]/255.0f;
+            c -= 0.5f;
+            c *= contrast;
+            c += 0.5f;
+            c *= 255;
+            if (c < 0) c = 0;
+            if (c > 255) c = 255;
+
+            pixels[i*4 + k] = (unsigned char)c;
+        }
+    }
+}
+
+// Apply brightness offset to RGB of RGBA8 pixels in place, alpha is kept
+// NOTE: Brightness expected between -255 and 255, values going below 0 are set to 1
+static void BrightnessPixelsRGBA8(unsigned char *pixels, int count, int brightness)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_AVX2)
+    if (GetImageSimdLevel() >= 2)
+    {
+        BrightnessPixelsRGBA8Avx2(pixels, count, brightness);
+        i = count/8*8;
+    }
+#endif
+#if defined(RTEXTURES_SSE2)
+    __m128i offset = _mm_set1_epi32(((brightness < 0)? -brightness : brightness)*0x010101);
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi8(1);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((__m128i *)(pixels + i*4));
+
+        if (brightness >= 0) p = _mm_adds_epu8(p, offset);
+        else
+        {
+            __m128i under = _mm_cmpeq_epi8(_mm_subs_epu8(offset, p), zero);
+            p = _mm_or_si128(_mm_subs_epu8(p, offset), _mm_andnot_si128(under, one));
+        }
+
+        _mm_storeu_si128((__m128i *)(pixels + i*4), p);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int c = pixels[i*4 + k] + brightness;
+            if (c < 0) c = 1;
+            if (c > 255) c = 255;
+
+            pixels[i*4 + k] = (unsigned char)c;
+        }
+    }
+}
+
+// Replace RGBA8 pixels matching color in place
+static void ReplacePixelsRGBA8(unsigned char *pixels, int count, Color color, Color replace)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_AVX2)
+    if (GetImageSimdLevel() >= 2)
+    {
+        ReplacePixelsRGBA8Avx2(pixels, count, color, replace);
+        i = count/8*8;
+    }
+#endif
+#if defined(RTEXTURES_SSE2)
+    unsigned int col = 0, rep = 0;
+    memcpy(&col, &color, 4);
+    memcpy(&rep, &replace, 4);
+    __m128i vcol = _mm_set1_epi32((int)col);
+    __m128i vrep = _mm_set1_epi32((int)rep);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((__m128i *)(pixels + i*4));
+        __m128i match = _mm_cmpeq_epi32(p, vcol);
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_or_si128(_mm_and_si128(match, vrep), _mm_andnot_si128(match, p)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned char *p = pixels + i*4;
+        if ((p[0] == color.r) && (p[1] == color.g) && (p[2] == color.b) && (p[3] == color.a))
+        {
+            p[0] = replace.r;
+            p[1] = replace.g;
+            p[2] = replace.b;
+            p[3] = replace.a;
+        }
+    }
+}
+
+// Convert RGBA8 pixels to grayscale, dst can alias src (written data never passes read data)
+// NOTE: Same float operations as ImageFormat() generic path, results are identical
+static void GrayscalePixelsRGBA8(const unsigned char *src, unsigned char *dst, int count)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SSE2)
+    __m128i byteMask = _mm_set1_epi32(0xff);
+    __m128 scale = _mm_set1_ps(255.0f);
+    __m128 wr = _mm_set1_ps(0.299f);
+    __m128 wg = _mm_set1_ps(0.587f);
+    __m128 wb = _mm_set1_ps(0.114f);
+
+    for (; i < count/16*16; i += 16)
+    {
+        __m128i gray[4] = { 0 };
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128i p = _mm_loadu_si128((const __m128i *)(src + (i + k*4)*4));
+            __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(p, byteMask)), scale);
+            __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 8), byteMask)), scale);
+            __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 16), byteMask)), scale);
+            __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, wr), _mm_mul_ps(g, wg)), _mm_mul_ps(b, wb));
+            gray[k] = _mm_cvttps_epi32(_mm_mul_ps(y, scale));
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(gray[0], gray[1]), _mm_packs_epi32(gray[2], gray[3])));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float r = (float)src[i*4]/255.0f;
+        float g = (float)src[i*4 + 1]/255.0f;
+        float b = (float)src[i*4 + 2]/255.0f;
+
+        dst[i] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+    }
+}
+
+// Alpha blend tinted RGBA8 row over RGBA8 row, same results as ColorAlphaBlend() per pixel
+// NOTE: Groups of 4 fully opaque or fully transparent pixels skip the blend
+static void BlendPixelsRGBA8(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RTEXTURES_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    __m128i vtint = _mm_set_epi16(tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1, tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1);
+    __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+
+    for (; i < count/4*4; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), vtint), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), vtint), 8);
+        __m128i tinted = _mm_packus_epi16(lo, hi);
+        __m128i alpha = _mm_and_si128(tinted, alphaMask);
+
+        int opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask));
+        int transparent = _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero));
+
+        if (opaque == 0xffff) _mm_storeu_si128((__m128i *)(dst + i*4), tinted);
+        else if (transparent != 0xffff)
+        {
+            for (int k = i; k < i + 4; k++)
+            {
+                Color colSrc = { src[k*4], src[k*4 + 1], src[k*4 + 2], src[k*4 + 3] };
+                Color colDst = { dst[k*4], dst[k*4 + 1], dst[k*4 + 2], dst[k*4 + 3] };
+                Color blend = ColorAlphaBlend(colDst, colSrc, tint);
+
+                dst[k*4] = blend.r;
+                dst[k*4 + 1] = blend.g;
+                dst[k*4 + 2] = blend.b;
+                dst[k*4 + 3] = blend.a;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color colSrc = { src[i*4], src[i*4 + 1], src[i*4 + 2], src[i*4 + 3] };
+        Color colDst = { dst[i*4], dst[i*4 + 1], dst[i*4 + 2], dst[i*4 + 3] };
+        Color blend = ColorAlphaBlend(colDst, colSrc, tint);
+
+        dst[i*4] = blend.r;
+        dst[i*4 + 1] = blend.g;
+        dst[i*4 + 2] = blend.b;
+        dst[i*4 + 3] = blend.a;
+    }
+}
+
+// Convert image data between common 8bit per channel formats in place, no normalized float copy
+// NOTE: Results match the generic ImageFormat() path, (unsigned char)((v/255.0f)*255.0f) == v for every byte value
+static bool ImageFormatDirect(Image *image, int newFormat)
+{
+    int count = image->width*image->height;
+    unsigned char *data = (unsigned char *)image->data;
+
+    if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE))
+    {
+        GrayscalePixelsRGBA8(data, data, count);
+    }
+    else if ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8))
+    {
+        for (int i = 0; i < count; i++)
+        {
+            data[i*3] = data[i*4];
+            data[i*3 + 1] = data[i*4 + 1];
+            data[i*3 + 2] = data[i*4 + 2];
+        }
+    }
+    else if (((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)) &&
+             (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        data = (unsigned char *)RL_REALLOC(image->data, count*4);
+        if (data == NULL) return false;     // Generic path will try again (and fail) with a new allocation
+        image->data = data;
+
+        // Expand from the end, so source pixels are read before being overwritten
+        if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8)
+        {
+            for (int i = count - 1; i >= 0; i--)
+            {
+                unsigned char r = data[i*3], g = data[i*3 + 1], b = data[i*3 + 2];
+
+                data[i*4] = r;
+                data[i*4 + 1] = g;
+                data[i*4 + 2] = b;
+                data[i*4 + 3] = 255;
+            }
+        }
+        else
+        {
+            for (int i = count - 1; i >= 0; i--)
+            {
+                unsigned char value = data[i];
+
+                data[i*4] = value;
+                data[i*4 + 1] = value;
+                data[i*4 + 2] = value;
+                data[i*4 + 3] = 255;
+            }
+        }
+    }
+    else return false;
+
+    // Shrink buffer after a reducing conversion, keep the old one if realloc fails
+    if (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        void *shrunk = RL_REALLOC(image->data, GetPixelDataSize(image->width, image->height, newFormat));
+        if (shrunk != NULL) image->data = shrunk;
+    }
+
+    image->format = newFormat;
+
+    return true;
+}
+
+// Check if a grayscale image color op should go through a lookup table
+// NOTE: The lookup table is itself a 256 pixels grayscale image, processed by the generic path
+static bool IsGrayscaleLookupRequired(const Image *image)
+{
+    return ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (image->mipmaps == 1) && (image->width*image->height > 256));
+}
+
+// Generate 256x1 grayscale image with values 0..255, used as lookup table
+static Image GenImageGrayscaleRamp(void)
+{
+    Image ramp = { 0 };
+
+    ramp.data = RL_MALLOC(256);
+    ramp.width = 256;
+    ramp.height = 1;
+    ramp.mipmaps = 1;
+    ramp.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+    for (int i = 0; i < 256; i++) ((unsigned char *)ramp.data)[i] = (unsigned char)i;
+
+    return ramp;
+}
+
+// Map grayscale image values through lookup image, lookup image is unloaded
+static void ImageApplyGrayscaleLookup(Image *image, Image lookup)
+{
+    unsigned char *data = (unsigned char *)image->data;
+    const unsigned char *table = (const unsigned char *)lookup.data;
+
+    for (int i = 0; i < image->width*image->height; i++) data[i] = table[data[i]];
+
+    UnloadImage(lookup);
+}
+
+// Get DXT1 block palette (RGBA8) from 565 endpoints
+// NOTE: DXT1 blocks with c0 <= c1 use 3 colors and transparent black, DXT3/DXT5 color blocks always use 4 colors
+static void GetDXT1Palette(unsigned short c0, unsigned short c1, bool fourColors, unsigned char palette[4][4])
+{
+    unsigned short endpoints[2] = { c0, c1 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        unsigned char r = (endpoints[i] >> 11) & 0x1f;
+        unsigned char g = (endpoints[i] >> 5) & 0x3f;
+        unsigned char b = endpoints[i] & 0x1f;
+
+        palette[i][0] = (r << 3) | (r >> 2);
+        palette[i][1] = (g << 2) | (g >> 4);
+        palette[i][2] = (b << 3) | (b >> 2);
+        palette[i][3] = 255;
+    }
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (fourColors || (c0 > c1))
+        {
+            palette[2][c] = (unsigned char)((2*palette[0][c] + palette[1][c] + 1)/3);
+            palette[3][c] = (unsigned char)((palette[0][c] + 2*palette[1][c] + 1)/3);
+        }
+        else
+        {
+            palette[2][c] = (unsigned char)((palette[0][c] + palette[1][c] + 1)/2);
+            palette[3][c] = 0;
+        }
+    }
+
+    palette[2][3] = 255;
+    palette[3][3] = (fourColors || (c0 > c1))? 255 : 0;
+}
+
+// Get DXT5 block alpha palette from endpoints
+// NOTE: Blocks with a0 > a1 use 8 interpolated values, otherwise 6 interpolated values plus 0 and 255
+static void GetDXT5AlphaPalette(unsigned char a0, unsigned char a1, unsigned char palette[8])
+{
+    palette[0] = a0;
+    palette[1] = a1;
+
+    if (a0 > a1)
+    {
+        for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*a0 + i*a1 + 3)/7);
+    }
+    else
+    {
+        for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*a0 + i*a1 + 2)/5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Encode 4x4 RGBA8 block to 8 bytes DXT1 color
+// NOTE: Endpoints are fitted along the principal axis of the block colors and refined once by least squares,
+// with punchThrough, pixels with alpha < 128 are encoded as transparent (3 colors mode)
+static void EncodeDXT1Block(const unsigned char block[16][4], bool punchThrough, unsigned char *output)
+{
+    bool transparent[16] = { 0 };
+    int opaqueCount = 0;
+    float mean[3] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        transparent[i] = punchThrough && (block[i][3] < 128);
+        if (transparent[i]) continue;
+
+        for (int c = 0; c < 3; c++) mean[c] += block[i][c];
+        opaqueCount++;
+    }
+
+    bool threeColors = (opaqueCount < 16);
+    unsigned short c0 = 0;
+    unsigned short c1 = 0;
+
+    if (opaqueCount > 0)
+    {
+        for (int c = 0; c < 3; c++) mean[c] /= opaqueCount;
+
+        // Principal axis of the colors covariance, by power iteration
+        float covariance[6] = { 0 };    // xx, xy, xz, yy, yz, zz
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent[i]) continue;
+
+            float d[3] = { block[i][0] - mean[0], block[i][1] - mean[1], block[i][2] - mean[2] };
+            covariance[0] += d[0]*d[0]; covariance[1] += d[0]*d[1]; covariance[2] += d[0]*d[2];
+            covariance[3] += d[1]*d[1]; covariance[4] += d[1]*d[2]; covariance[5] += d[2]*d[2];
+        }
+
+        float axis[3] = { 1.0f, 1.0f, 1.0f };
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            float x = covariance[0]*axis[0] + covariance[1]*axis[1] + covariance[2]*axis[2];
+            float y = covariance[1]*axis[0] + covariance[3]*axis[1] + covariance[4]*axis[2];
+            float z = covariance[2]*axis[0] + covariance[4]*axis[1] + covariance[5]*axis[2];
+            float length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
+
+            if (length < 1e-6f) break;
+
+            axis[0] = x/length;
+            axis[1] = y/length;
+            axis[2] = z/length;
+        }
+
+        float axisLengthSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+        float minProjection = 0.0f;
+        float maxProjection = 0.0f;
+        float projection[16] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent[i]) continue;
+
+            projection[i] = ((block[i][0] - mean[0])*axis[0] + (block[i][1] - mean[1])*axis[1] + (block[i][2] - mean[2])*axis[2])/axisLengthSq;
+            minProjection = fminf(minProjection, projection[i]);
+            maxProjection = fmaxf(maxProjection, projection[i]);
+        }
+
+        float endpoints[2][3] = { 0 };
+        for (int c = 0; c < 3; c++)
+        {
+            endpoints[0][c] = mean[c] + axis[c]*maxProjection;
+            endpoints[1][c] = mean[c] + axis[c]*minProjection;
+        }
+
+        // Least squares refine of the endpoints, for the interpolation steps of the projected colors
+        int steps = threeColors? 2 : 3;
+        if (maxProjection > minProjection)
+        {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ax[3] = { 0 }, bx[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                if (transparent[i]) continue;
+
+                int step = (int)((maxProjection - projection[i])/(maxProjection - minProjection)*steps + 0.5f);
+                float b = (float)step/steps;
+                float a = 1.0f - b;
+
+                aa += a*a; ab += a*b; bb += b*b;
+                for (int c = 0; c < 3; c++) { ax[c] += a*block[i][c]; bx[c] += b*block[i][c]; }
+            }
+
+            float determinant = aa*bb - ab*ab;
+            if (fabsf(determinant) > 1e-6f)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    endpoints[0][c] = (ax[c]*bb - bx[c]*ab)/determinant;
+                    endpoints[1][c] = (bx[c]*aa - ax[c]*ab)/determinant;
+                }
+            }
+        }
+
+        unsigned short quantized[2] = { 0 };
+        for (int e = 0; e < 2; e++)
+        {
+            int r = (int)(fminf(fmaxf(endpoints[e][0], 0.0f), 255.0f)*31.0f/255.0f + 0.5f);
+            int g = (int)(fminf(fmaxf(endpoints[e][1], 0.0f), 255.0f)*63.0f/255.0f + 0.5f);
+            int b = (int)(fminf(fmaxf(endpoints[e][2], 0.0f), 255.0f)*31.0f/255.0f + 0.5f);
+            quantized[e] = (unsigned short)((r << 11) | (g << 5) | b);
+        }
+
+        // 4 colors mode requires c0 > c1, 3 colors mode requires c0 <= c1
+        c0 = quantized[0];
+        c1 = quantized[1];
+        if ((!threeColors && (c0 < c1)) || (threeColors && (c0 > c1)))
+        {
+            c0 = quantized[1];
+            c1 = quantized[0];
+        }
+    }
+
+    unsigned char palette[4][4] = { 0 };
+    GetDXT1Palette(c0, c1, false, palette);
+
+    // Final indices are chosen against the decoded palette, so encoder and decoder always agree
+    unsigned int indices = 0;
+    int paletteCount = (c0 > c1)? 4 : 3;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = 3;
+
+        if (!transparent[i])
+        {
+            int bestError = 0x7fffffff;
+            for (int p = 0; (p < paletteCount) && (c0 != c1); p++)
+            {
+                int dr = block[i][0] - palette[p][0];
+                int dg = block[i][1] - palette[p][1];
+                int db = block[i][2] - palette[p][2];
+                int error = dr*dr + dg*dg + db*db;
+
+                if (error < bestError) { bestError = error; index = p; }
+            }
+
+            if (c0 == c1) index = 0;
+        }
+
+        indices |= (unsigned int)index << (2*i);
+    }
+
+    output[0] = (unsigned char)(c0 & 0xff);
+    output[1] = (unsigned char)(c0 >> 8);
+    output[2] = (unsigned char)(c1 & 0xff);
+    output[3] = (unsigned char)(c1 >> 8);
+    for (int i = 0; i < 4; i++) output[4 + i] = (unsigned char)(indices >> (8*i));
+}
+
+// Encode 4x4 RGBA8 block alpha to 8 bytes DXT5 alpha
+// NOTE: Both 8 values mode (alpha range) and 6 values mode (range without 0 and 255) are tried, lower error is kept
+static void EncodeDXT5AlphaBlock(const unsigned char block[16][4], unsigned char *output)
+{
+    unsigned char minAlpha = 255, maxAlpha = 0;
+    unsigned char minInner = 255, maxInner = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        unsigned char alpha = block[i][3];
+        if (alpha < minAlpha) minAlpha = alpha;
+        if (alpha > maxAlpha) maxAlpha = alpha;
+
+        if ((alpha != 0) && (alpha != 255))
+        {
+            if (alpha < minInner) minInner = alpha;
+            if (alpha > maxInner) maxInner = alpha;
+        }
+    }
+
+    if (minInner > maxInner) { minInner = 0; maxInner = 255; }
+
+    unsigned char candidates[2][2] = { { maxAlpha, minAlpha }, { minInner, maxInner } };
+    unsigned long long bestBits = 0;
+    int bestError = 0x7fffffff;
+    int bestMode = 0;
+
+    for (int mode = 0; mode < 2; mode++)
+    {
+        unsigned char palette[8] = { 0 };
+        GetDXT5AlphaPalette(candidates[mode][0], candidates[mode][1], palette);
+
+        unsigned long long bits = 0;
+        int totalError = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int index = 0;
+            int bestPixelError = 0x7fffffff;
+
+            for (int p = 0; p < 8; p++)
+            {
+                int error = (block[i][3] - palette[p])*(block[i][3] - palette[p]);
+                if (error < bestPixelError) { bestPixelError = error; index = p; }
+            }
+
+            bits |= (unsigned long long)index << (3*i);
+            totalError += bestPixelError;
+        }
+
+        if (totalError < bestError)
+        {
+            bestError = totalError;
+            bestBits = bits;
+            bestMode = mode;
+        }
+    }
+
+    output[0] = candidates[bestMode][0];
+    output[1] = candidates[bestMode][1];
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)(bestBits >> (8*i));
+}
+
+// Encode RGBA8 image (all mipmaps) to DXT1 or DXT5
+// NOTE: Partial blocks on the edges repeat the last row/column of pixels
+static void ImageCompressDXT(Image *image, int format)
+{
+    int blockBytes = (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)? 16 : 8;
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    const unsigned char *source = (const unsigned char *)image->data;
+    unsigned char *output = data;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        for (int by = 0; by < height; by += 4)
+        {
+            for (int bx = 0; bx < width; bx += 4)
+            {
+                unsigned char block[16][4] = { 0 };
+
+                for (int y = 0; y < 4; y++)
+                {
+                    for (int x = 0; x < 4; x++)
+                    {
+                        int sx = (bx + x < width)? bx + x : width - 1;
+                        int sy = (by + y < height)? by + y : height - 1;
+                        memcpy(block[y*4 + x], source + (sy*width + sx)*4, 4);
+                    }
+                }
+
+                if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)
+                {
+                    EncodeDXT5AlphaBlock(block, output);
+                    EncodeDXT1Block(block, false, output + 8);
+                }
+                else EncodeDXT1Block(block, (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA), output);
+
+                output += blockBytes;
+            }
+        }
+
+        source += width*height*4;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = format;
+}
+
+// Decode DXT1/DXT3/DXT5 image (all mipmaps) to RGBA8
+static void ImageDecompressDXT(Image *image)
+{
+    int format = image->format;
+    int blockBytes = ((format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA))? 8 : 16;
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        dataSize += width*height*4;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    const unsigned char *input = (const unsigned char *)image->data;
+    unsigned char *output = data;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++)
+    {
+        for (int by = 0; by < height; by += 4)
+        {
+            for (int bx = 0; bx < width; bx += 4)
+            {
+                const unsigned char *color = (blockBytes == 16)? input + 8 : input;
+                unsigned short c0 = (unsigned short)(color[0] | (color[1] << 8));
+                unsigned short c1 = (unsigned short)(color[2] | (color[3] << 8));
+                unsigned int indices = (unsigned int)(color[4] | (color[5] << 8) | (color[6] << 16) | ((unsigned int)color[7] << 24));
+
+                unsigned char palette[4][4] = { 0 };
+                GetDXT1Palette(c0, c1, (blockBytes == 16), palette);
+
+                unsigned char alphaPalette[8] = { 0 };
+                unsigned long long alphaBits = 0;
+                if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)
+                {
+                    GetDXT5AlphaPalette(input[0], input[1], alphaPalette);
+                    for (int b = 0; b < 6; b++) alphaBits |= (unsigned long long)input[2 + b] << (8*b);
+                }
+                else if (format == PIXELFORMAT_COMPRESSED_DXT3_RGBA)
+                {
+                    for (int b = 0; b < 8; b++) alphaBits |= (unsigned long long)input[b] << (8*b);
+                }
+
+                for (int p = 0; p < 16; p++)
+                {
+                    int x = bx + p%4;
+                    int y = by + p/4;
+                    if ((x >= width) || (y >= height)) continue;
+
+                    unsigned char *pixel = output + (y*width + x)*4;
+                    memcpy(pixel, palette[(indices >> (2*p)) & 0x3], 4);
+
+                    if (format == PIXELFORMAT_COMPRESSED_DXT1_RGB) pixel[3] = 255;
+                    else if (format == PIXELFORMAT_COMPRESSED_DXT3_RGBA) pixel[3] = (unsigned char)(((alphaBits >> (4*p)) & 0xf)*17);
+                    else if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) pixel[3] = alphaPalette[(alphaBits >> (3*p)) & 0x7];
+                }
+
+                input += blockBytes;
+            }
+        }
+
+        output += width*height*4;
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+
+
+#if defined(RTEXTURES_THREADS)
+#if defined(_WIN32)
+static unsigned long __stdcall ImageWorkerThread(void *worker) { ((ImageWorker *)worker)->run(((ImageWorker *)worker)->job); return 0; }
+#else
+static void *ImageWorkerThread(void *worker) { ((ImageWorker *)worker)->run(((ImageWorker *)worker)->job); return NULL; }
+#endif
+#endif
+
+// Run workers, first one runs on calling thread and the others on worker threads if supported
+// NOTE: A worker whose thread could not be created runs on the calling thread instead
+static void RunImageWorkers(ImageWorker *workers, int count)
+{
+#if defined(RTEXTURES_THREADS)
+#if defined(_WIN32)
+    void *threads[IMAGE_MAX_WORKERS] = { 0 };
+    for (int j = 1; j < count; j++) threads[j] = CreateThread(NULL, 0, ImageWorkerThread, &workers[j], 0, NULL);
+
+    workers[0].run(workers[0].job);
+
+    for (int j = 1; j < count; j++)
+    {
+        if (threads[j] != NULL)
+        {
+            WaitForSingleObject(threads[j], 0xFFFFFFFF);    // INFINITE
+            CloseHandle(threads[j]);
+        }
+        else workers[j].run(workers[j].job);
+    }
+#else
+    pthread_t threads[IMAGE_MAX_WORKERS];
+    bool started[IMAGE_MAX_WORKERS] = { 0 };
+    for (int j = 1; j < count; j++) started[j] = (pthread_create(&threads[j], NULL, ImageWorkerThread, &workers[j]) == 0);
+
+    workers[0].run(workers[0].job);
+
+    for (int j = 1; j < count; j++)
+    {
+        if (started[j]) pthread_join(threads[j], NULL);
+        else workers[j].run(workers[j].job);
+    }
+#endif
+#else
+    for (int j = 0; j < count; j++) workers[j].run(workers[j].job);
+#endif
+}
+
+// Load images from a batch job until no files are left
+// NOTE: A .qoi file next to the requested one (same name) is loaded instead, it decodes several times faster than png,
+// only if it is not older than the requested file, a stale .qoi left behind after editing the source is ignored
+static void LoadImageBatchFiles(void *data)
+{
+    ImageBatchJob *job = (ImageBatchJob *)data;
+
+    while (true)
+    {
+    #if defined(_MSC_VER)
+        int index = (int)_InterlockedExchangeAdd(&job->next, 1);
+    #else
+        int index = (int)__atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+    #endif
+        if (index >= job->count) break;
+
+        const char *fileName = job->fileNames[index];
+        if (fileName == NULL) continue;
+
+    #if defined(SUPPORT_FILEFORMAT_QOI)
+        const char *extension = strrchr(fileName, '.');
+        if ((extension != NULL) && ((strchr(extension, '/') != NULL) || (strchr(extension, '\\') != NULL))) extension = NULL;   // Dot in a directory name
+        int baseLength = (extension != NULL)? (int)(extension - fileName) : (int)strlen(fileName);
+
+        if ((extension != NULL) && (strcmp(extension, ".qoi") != 0) && (strcmp(extension, ".QOI") != 0) && (baseLength + 5 <= MAX_FILEPATH_LENGTH))
+        {
+            char qoiFileName[MAX_FILEPATH_LENGTH] = { 0 };
+            memcpy(qoiFileName, fileName, baseLength);
+            memcpy(qoiFileName + baseLength, ".qoi", 5);
+
+            if (FileExists(qoiFileName) && (GetFileModTime(qoiFileName) >= GetFileModTime(fileName)))
+            {
+                TRACELOG(LOG_DEBUG, "IMAGE: [%s] Loading .qoi file instead: %s", fileName, qoiFileName);
+                job->images[index] = LoadImage(qoiFileName);
+                if (job->images[index].data != NULL) continue;
+            }
+        }
+    #endif
+
+        job->images[index] = LoadImage(fileName);
+    }
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Process all row tiles assigned to an image generation job
+static void ProcessImageTiles(void *data)
+{
+    ImageTileJob *job = (ImageTileJob *)data;
+
+    for (int tile = job->first; tile*IMAGE_GENERATION_TILE_ROWS < job->height; tile += job->step)
+    {
+        int startY = tile*IMAGE_GENERATION_TILE_ROWS;
+        int endY = (startY + IMAGE_GENERATION_TILE_ROWS < job->height)? startY + IMAGE_GENERATION_TILE_ROWS : job->height;
+
+        job->process(job->params, job->pixels, startY, endY);
+    }
+}
+
+// Generate image row tiles, on worker threads if supported
+// NOTE: Tiles are interleaved across jobs, see ProcessImageTiles()
+static void RunImageTileJobs(void (*process)(const void *, Color *, int, int), const void *params, Color *pixels, int height)
+{
+    int tileCount = (height + IMAGE_GENERATION_TILE_ROWS - 1)/IMAGE_GENERATION_TILE_ROWS;
+    int jobCount = 1;
+#if defined(SUPPORT_IMAGE_GENERATION_THREADS)
+    jobCount = (tileCount < IMAGE_GENERATION_MAX_THREADS)? tileCount : IMAGE_GENERATION_MAX_THREADS;
+    if (jobCount < 1) jobCount = 1;
+#endif
+
+    ImageTileJob jobs[IMAGE_GENERATION_MAX_THREADS] = { 0 };
+    ImageWorker workers[IMAGE_GENERATION_MAX_THREADS] = { 0 };
+    for (int j = 0; j < jobCount; j++)
+    {
+        jobs[j] = (ImageTileJob){ process, params, pixels, height, j, jobCount };
+        workers[j] = (ImageWorker){ ProcessImageTiles, &jobs[j] };
+    }
+
+    RunImageWorkers(workers, jobCount);
+}
+
+#if defined(RTEXTURES_SSE2)
+// Gradient directions used by stb_perlin_noise3_internal(), padded to 4 floats
+static const float perlinGradients[12][4] = {
+    {  1, 1, 0, 0 }, { -1, 1, 0, 0 }, {  1,-1, 0, 0 }, { -1,-1, 0, 0 },
+    {  1, 0, 1, 0 }, { -1, 0, 1, 0 }, {  1, 0,-1, 0 }, { -1, 0,-1, 0 },
+    {  0, 1, 1, 0 }, {  0,-1, 1, 0 }, {  0, 1,-1, 0 }, {  0,-1,-1, 0 }
+};
+
+// Dot products of 4 gradients (one per lane) with offset (x, y, z)
+static inline __m128 PerlinGradDot4(const unsigned char *gradIndex, __m128 x, __m128 y, __m128 z)
+{
+    __m128 gx = _mm_loadu_ps(perlinGradients[gradIndex[0]]);
+    __m128 gy = _mm_loadu_ps(perlinGradients[gradIndex[1]]);
+    __m128 gz = _mm_loadu_ps(perlinGradients[gradIndex[2]]);
+    __m128 gw = _mm_loadu_ps(perlinGradients[gradIndex[3]]);
+    _MM_TRANSPOSE4_PS(gx, gy, gz, gw);
+
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, x), _mm_mul_ps(gy, y)), _mm_mul_ps(gz, z));
+}
+
+// Perlin noise fbm for 4 points sharing y and z, stb_perlin_fbm_noise3() evaluated per lane
+// NOTE: Same float operations in the same order as stb_perlin, results are identical
+static __m128 PerlinFbmNoise4(__m128 x, float y, float z, float lacunarity, float gain, int octaves)
+{
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
+    __m128 sum = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+
+    for (int i = 0; i < octaves; i++)
+    {
+        unsigned char seed = (unsigned char)i;
+
+        // Lanes: fastfloor() and fractional part of x
+        __m128 fx = _mm_mul_ps(x, _mm_set1_ps(frequency));
+        __m128i px = _mm_cvttps_epi32(fx);
+        px = _mm_add_epi32(px, _mm_castps_si128(_mm_cmplt_ps(fx, _mm_cvtepi32_ps(px))));
+        fx = _mm_sub_ps(fx, _mm_cvtepi32_ps(px));
+        __m128 u = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(fx, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), fx), _mm_set1_ps(10.0f)), fx), fx), fx);
+
+        // Shared: y and z are the same for all lanes
+        float fy = y*frequency;
+        float fz = z*frequency;
+        int py = (int)fy;
+        int pz = (int)fz;
+        if (fy < py) py--;
+        if (fz < pz) pz--;
+        int y0 = py & 255, y1 = (py + 1) & 255;
+        int z0 = pz & 255, z1 = (pz + 1) & 255;
+        fy -= py;
+        fz -= pz;
+        float v = ((fy*6 - 15)*fy + 10)*fy*fy*fy;
+        float w = ((fz*6 - 15)*fz + 10)*fz*fz*fz;
+
+        int lanes[4] = { 0 };
+        _mm_storeu_si128((__m128i *)lanes, px);
+
+        unsigned char grad[8][4] = { 0 };   // Gradient index per corner (z-y-x order as n000..n111) and lane
+        for (int l = 0; l < 4; l++)
+        {
+            int r0 = stb__perlin_randtab[(lanes[l] & 255) + seed];
+            int r1 = stb__perlin_randtab[((lanes[l] + 1) & 255) + seed];
+            int r00 = stb__perlin_randtab[r0 + y0];
+            int r01 = stb__perlin_randtab[r0 + y1];
+            int r10 = stb__perlin_randtab[r1 + y0];
+            int r11 = stb__perlin_randtab[r1 + y1];
+
+            grad[0][l] = stb__perlin_randtab_grad_idx[r00 + z0];
+            grad[1][l] = stb__perlin_randtab_grad_idx[r00 + z1];
+            grad[2][l] = stb__perlin_randtab_grad_idx[r01 + z0];
+            grad[3][l] = stb__perlin_randtab_grad_idx[r01 + z1];
+            grad[4][l] = stb__perlin_randtab_grad_idx[r10 + z0];
+            grad[5][l] = stb__perlin_randtab_grad_idx[r10 + z1];
+            grad[6][l] = stb__perlin_randtab_grad_idx[r11 + z0];
+            grad[7][l] = stb__perlin_randtab_grad_idx[r11 + z1];
+        }
+
+        __m128 x1 = _mm_sub_ps(fx, one);
+        __m128 vy0 = _mm_set1_ps(fy), vy1 = _mm_set1_ps(fy - 1);
+        __m128 vz0 = _mm_set1_ps(fz), vz1 = _mm_set1_ps(fz - 1);
+        __m128 vv = _mm_set1_ps(v), vw = _mm_set1_ps(w);
+
+        __m128 n000 = PerlinGradDot4(grad[0], fx, vy0, vz0);
+        __m128 n001 = PerlinGradDot4(grad[1], fx, vy0, vz1);
+        __m128 n010 = PerlinGradDot4(grad[2], fx, vy1, vz0);
+        __m128 n011 = PerlinGradDot4(grad[3], fx, vy1, vz1);
+        __m128 n100 = PerlinGradDot4(grad[4], x1, vy0, vz0);
+        __m128 n101 = PerlinGradDot4(grad[5], x1, vy0, vz1);
+        __m128 n110 = PerlinGradDot4(grad[6], x1, vy1, vz0);
+        __m128 n111 = PerlinGradDot4(grad[7], x1, vy1, vz1);
+
+        // Lerp: a + (b - a)*t
+        __m128 n00 = _mm_add_ps(n000, _mm_mul_ps(_mm_sub_ps(n001, n000), vw));
+        __m128 n01 = _mm_add_ps(n010, _mm_mul_ps(_mm_sub_ps(n011, n010), vw));
+        __m128 n10 = _mm_add_ps(n100, _mm_mul_ps(_mm_sub_ps(n101, n100), vw));
+        __m128 n11 = _mm_add_ps(n110, _mm_mul_ps(_mm_sub_ps(n111, n110), vw));
+        __m128 n0 = _mm_add_ps(n00, _mm_mul_ps(_mm_sub_ps(n01, n00), vv));
+        __m128 n1 = _mm_add_ps(n10, _mm_mul_ps(_mm_sub_ps(n11, n10), vv));
+        __m128 n = _mm_add_ps(n0, _mm_mul_ps(_mm_sub_ps(n1, n0), u));
+
+        sum = _mm_add_ps(sum, _mm_mul_ps(n, _mm_set1_ps(amplitude)));
+        frequency *= lacunarity;
+        amplitude *= gain;
+    }
+
+    return sum;
+}
+#endif
+
+// Generate perlin noise image rows
+static void GenPerlinNoiseRows(const void *params, Color *pixels, int startY, int endY)
+{
+    const PerlinNoiseParams *noise = (const PerlinNoiseParams *)params;
+    int width = noise->width;
+    int height = noise->height;
+
+    float aspectRatio = (float)width / (float)height;
+    for (int y = startY; y < endY; y++)
+    {
+        float ny = (float)(y + noise->offsetY)*(noise->scale/(float)height);
+
+        // Apply aspect ratio compensation to wider side
+        if (width <= height) ny /= aspectRatio;
+
+        int x = 0;
+
+#if defined(RTEXTURES_SSE2)
+        // Groups of 4 pixels share ny, noise evaluated in SIMD lanes
+        __m128 scaleX = _mm_set1_ps(noise->scale/(float)width);
+        __m128i alpha = _mm_set1_epi32((int)0xff000000);
+
+        for (; x < width/4*4; x += 4)
+        {
+            __m128i ix = _mm_add_epi32(_mm_set1_epi32(x + noise->offsetX), _mm_set_epi32(3, 2, 1, 0));
+            __m128 nx = _mm_mul_ps(_mm_cvtepi32_ps(ix), scaleX);
+            if (width > height) nx = _mm_mul_ps(nx, _mm_set1_ps(aspectRatio));
+
+            __m128 p = PerlinFbmNoise4(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+            p = _mm_min_ps(_mm_max_ps(p, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+            __m128 np = _mm_div_ps(_mm_add_ps(p, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f));
+
+            __m128i intensity = _mm_cvttps_epi32(_mm_mul_ps(np, _mm_set1_ps(255.0f)));
+            intensity = _mm_or_si128(_mm_or_si128(intensity, _mm_slli_epi32(intensity, 8)), _mm_or_si128(_mm_slli_epi32(intensity, 16), alpha));
+            _mm_storeu_si128((__m128i *)(pixels + y*width + x), intensity);
+        }
+#endif
+
+        for (; x < width; x++)
+        {
+            float nx = (float)(x + noise->offsetX)*(noise->scale/(float)width);
+            if (width > height) nx *= aspectRatio;
+
+            // Basic perlin noise implementation (not used)
+            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
+
+            // Calculate a better perlin noise using fbm (fractal brownian motion)
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            int intensity = (int)(np*255.0f);
+            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+
+// Generate cellular image rows
+// NOTE: Nearest seed is found comparing exact integer squared distances, hypot() is only
+// evaluated for the nearest ones, same result as taking the minimum hypot() of all neighbors
+static void GenCellularRows(const void *params, Color *pixels, int startY, int endY)
+{
+    const CellularParams *cells = (const CellularParams *)params;
+    int width = cells->width;
+    int tileSize = cells->tileSize;
+
+    for (int y = startY; y < endY; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int tileX = 0; tileX*tileSize < width; tileX++)
+        {
+            // Gather seeds of all adjacent tiles, shared by the pixels of this tile row
+            int neighbors[9][2] = { 0 };
+            int neighborCount = 0;
+
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= cells->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= cells->seedsPerCol)) continue;
+
+                    const int *seed = cells->seeds + ((tileY + j)*cells->seedsPerRow + tileX + i)*2;
+                    neighbors[neighborCount][0] = seed[0];
+                    neighbors[neighborCount][1] = y - seed[1];
+                    neighborCount++;
+                }
+            }
+
+            int endX = (tileX*tileSize + tileSize < width)? tileX*tileSize + tileSize : width;
+
+            for (int x = tileX*tileSize; x < endX; x++)
+            {
+                long long nearest = -1;
+                for (int n = 0; n < neighborCount; n++)
+                {
+                    long long dx = x - neighbors[n][0];
+                    long long dy = neighbors[n][1];
+                    long long distance = dx*dx + dy*dy;
+                    if ((nearest < 0) || (distance < nearest)) nearest = distance;
+                }
+
+                float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
+
+                for (int n = 0; n < neighborCount; n++)
+                {
+                    long long dx = x - neighbors[n][0];
+                    long long dy = neighbors[n][1];
+                    if ((dx*dx + dy*dy) == nearest) minDistance = (float)fmin(minDistance, (float)hypot(x - neighbors[n][0], neighbors[n][1]));
+                }
+
+                // I made this up, but it seems to give good results at all tile sizes
+                int intensity = (int)(minDistance*256.0f/tileSize);
+                if (intensity > 255) intensity = 255;
+
+                pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
 #endif      // SUPPORT_MODULE_RTEXTURES